@@ -2,11 +2,133 @@
 #include <random>
 #include <cstdlib>
 
+/* The per instruction set targets (CinMathBenchmark_<isa>) select the tier on the command line */
+#ifndef CIN_MATH_INSTRUCTION_SET_FROM_BUILD
 #define CIN_USE_DEFAULT_INSTRUCTION_SET
 //#define CIN_USE_SSE
 //#define CIN_USE_AVX
+#endif
 #include "CinMath/CinMath.h"
 
+#include <vector>
+
+/*
+ * Built with libpfm (CINMATH_BENCHMARK_PERF_COUNTERS) and run with --benchmark_perf_counters=CYCLES,INSTRUCTIONS,...
+ * every benchmark also reports the hardware counters per iteration. ReportPerElement turns them into the numbers
+ * that tell a latency bound kernel from a throughput or memory bound one: cycles per element and instructions per
+ * cycle. Without counters only the items per second are reported
+ */
+static void ReportPerElement(benchmark::State& state, const std::size_t elementsPerIteration) noexcept
+{
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(elementsPerIteration));
+
+	const auto cycles{ state.counters.find("CYCLES") };
+	if (cycles == state.counters.end() || cycles->second.value == 0.0)
+		return;
+
+	/* Perf counters hold the total of all iterations and are averaged per iteration when reported */
+	state.counters["CyclesPerElement"] = benchmark::Counter(cycles->second.value / static_cast<double>(elementsPerIteration), benchmark::Counter::kAvgIterations);
+
+	const auto instructions{ state.counters.find("INSTRUCTIONS") };
+	if (instructions != state.counters.end())
+		state.counters["IPC"] = benchmark::Counter(instructions->second.value / cycles->second.value);
+}
+
+static std::vector<CinMath::Vector4> RandomVectors(const std::size_t count)
+{
+	std::mt19937 generator{ 2022U };
+	std::uniform_real_distribution<float> distribution{ -100.0f, 100.0f };
+
+	std::vector<CinMath::Vector4> vectors(count);
+	for (CinMath::Vector4& vector : vectors)
+		vector = CinMath::Vector4{ distribution(generator), distribution(generator), distribution(generator), distribution(generator) };
+
+	return vectors;
+}
+
+static std::vector<CinMath::Matrix4> RandomMatrices(const std::size_t count)
+{
+	std::mt19937 generator{ 2023U };
+	std::uniform_real_distribution<float> distribution{ -1.0f, 1.0f };
+
+	std::vector<CinMath::Matrix4> matrices(count);
+	for (CinMath::Matrix4& matrix : matrices)
+	{
+		for (float& value : matrix.raw)
+			value = distribution(generator);
+
+		/* Diagonally dominant, so every matrix is invertible */
+		matrix.raw[0] += 4.0f;
+		matrix.raw[5] += 4.0f;
+		matrix.raw[10] += 4.0f;
+		matrix.raw[15] += 4.0f;
+	}
+
+	return matrices;
+}
+
+/*
+ * Every kernel is measured twice. The latency variant feeds each result into the next call (acc = acc * b), a
+ * dependent chain like a hierarchy update, so it measures the time from input to result. The throughput variant
+ * applies the kernel to independent random elements, arrays from L1 sized to memory sized, so it measures how
+ * many calls the core (or the memory) sustains when they can overlap
+ */
+
+/* Dependent calls per iteration of the latency variants, amortizes the loop and DoNotOptimize */
+static constexpr std::size_t s_ChainLength{ 16U };
+
+template<typename Element, typename Operation>
+static void RunLatencyBenchmark(benchmark::State& state, const Element& initial, Operation operation) noexcept
+{
+	Element value{ initial };
+	for (const auto _ : state)
+	{
+		for (std::size_t i{ 0U }; i < s_ChainLength; ++i)
+			value = operation(value);
+
+		benchmark::DoNotOptimize(value);
+	}
+
+	ReportPerElement(state, s_ChainLength);
+}
+
+/* Applies operation to every element of a random array of state.range(0) elements, the results are kept so the work is not optimized away */
+template<typename Element, typename Operation>
+static void RunThroughputBenchmark(benchmark::State& state, const std::vector<Element>& input, Operation operation) noexcept
+{
+	typedef std::remove_cvref_t<decltype(operation(input[0]))> Result;
+	std::vector<Result> output(input.size());
+
+	for (const auto _ : state)
+	{
+		for (std::size_t i{ 0U }; i < input.size(); ++i)
+			output[i] = operation(input[i]);
+
+		benchmark::DoNotOptimize(output.data());
+		benchmark::ClobberMemory();
+	}
+
+	ReportPerElement(state, input.size());
+}
+
+/* 64 to 262144 elements, 4 KiB to 16 MiB of Matrix4 */
+static void ThroughputSizes(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->RangeMultiplier(8)->Range(64, 262144);
+}
+
+static std::size_t ArrayLength(const benchmark::State& state) noexcept
+{
+	return static_cast<std::size_t>(state.range(0));
+}
+
+/* A rotation keeps a chain of products bounded, no overflow or denormals however long it runs */
+static CinMath::Matrix4 ChainRotation() noexcept
+{
+	return CinMath::RotateZIdentity<4, 4, float>(CinMath::Angle{ CinMath::TRadians<float>{ 0.1f } });
+}
+
+/* Kept unchanged for the stored baselines: the same constant product every iteration, neither latency nor throughput */
 static void BM_Matrix4x4Multiplication(benchmark::State& state) noexcept
 {
 	srand(static_cast<unsigned int>(time(nullptr)));
@@ -31,8 +153,243 @@ static void BM_Matrix4x4Multiplication(benchmark::State& state) noexcept
 	for (const auto _ : state)
 		benchmark::DoNotOptimize(a * b);
 
-	state.SetItemsProcessed(state.iterations());
+	ReportPerElement(state, 1U);
+}
+
+/* Matrix4.inl */
+static void BM_Matrix4MultiplyLatency(benchmark::State& state) noexcept
+{
+	const CinMath::Matrix4 rhs{ ChainRotation() };
+	RunLatencyBenchmark(state, RandomMatrices(1U)[0], [&rhs](const CinMath::Matrix4& matrix) noexcept { return matrix * rhs; });
+}
+
+static void BM_Matrix4MultiplyThroughput(benchmark::State& state) noexcept
+{
+	const CinMath::Matrix4 rhs{ RandomMatrices(1U)[0] };
+	RunThroughputBenchmark(state, RandomMatrices(ArrayLength(state)), [&rhs](const CinMath::Matrix4& matrix) noexcept { return matrix * rhs; });
+}
+
+static void BM_Matrix4VectorLatency(benchmark::State& state) noexcept
+{
+	const CinMath::Matrix4 matrix{ ChainRotation() };
+	RunLatencyBenchmark(state, RandomVectors(1U)[0], [&matrix](const CinMath::Vector4& vector) noexcept { return matrix * vector; });
+}
+
+static void BM_Matrix4VectorThroughput(benchmark::State& state) noexcept
+{
+	const CinMath::Matrix4 matrix{ RandomMatrices(1U)[0] };
+	RunThroughputBenchmark(state, RandomVectors(ArrayLength(state)), [&matrix](const CinMath::Vector4& vector) noexcept { return matrix * vector; });
+}
+
+/* Batch.inl */
+/* The batch kernels against the per element loops above, column vectors (TransformPoints) and row vectors */
+template<bool transposed>
+static void BM_TransformPointsBatch(benchmark::State& state) noexcept
+{
+	const CinMath::Matrix4 matrix{ RandomMatrices(1U)[0] };
+	const std::vector<CinMath::Vector4> input{ RandomVectors(ArrayLength(state)) };
+	std::vector<CinMath::Vector4> output(input.size());
+
+	for (const auto _ : state)
+	{
+		if constexpr (transposed)
+			CinMath::TransformPointsTransposed(matrix, input.data(), output.data(), input.size());
+		else
+			CinMath::TransformPoints(matrix, input.data(), output.data(), input.size());
+
+		benchmark::DoNotOptimize(output.data());
+		benchmark::ClobberMemory();
+	}
+
+	ReportPerElement(state, input.size());
+}
+
+static void BM_Vector4MatrixThroughput(benchmark::State& state) noexcept
+{
+	const CinMath::Matrix4 matrix{ RandomMatrices(1U)[0] };
+	RunThroughputBenchmark(state, RandomVectors(ArrayLength(state)), [&matrix](const CinMath::Vector4& vector) noexcept { return vector * matrix; });
+}
+
+/* Array of matrices to the lane layout of the eight wide kernels */
+static void BM_TransposeArrayToLanes(benchmark::State& state) noexcept
+{
+	const std::vector<CinMath::Matrix4> input{ RandomMatrices(ArrayLength(state)) };
+	std::vector<float> lanes(CinMath::MatrixLanesLength(input.size()));
+
+	for (const auto _ : state)
+	{
+		CinMath::TransposeArray(input.data(), lanes.data(), input.size());
+		benchmark::DoNotOptimize(lanes.data());
+		benchmark::ClobberMemory();
+	}
+
+	ReportPerElement(state, input.size());
+}
+
+/* Decompose of every matrix one at a time (false) or eight at a time through the lane kernel (true) */
+template<bool batched>
+static void BM_DecomposeArray(benchmark::State& state) noexcept
+{
+	const std::vector<CinMath::Matrix4> matrices{ RandomMatrices(ArrayLength(state)) };
+	std::vector<CinMath::Vector3> translations(matrices.size());
+	std::vector<CinMath::Quaternion> rotations(matrices.size());
+	std::vector<CinMath::Vector3> scales(matrices.size());
+
+	for (const auto _ : state)
+	{
+		if constexpr (batched)
+			CinMath::DecomposeArray(matrices.data(), translations.data(), rotations.data(), scales.data(), matrices.size());
+		else
+			for (std::size_t i{ 0U }; i < matrices.size(); ++i)
+				CinMath::Decompose(matrices[i], translations[i], rotations[i], scales[i]);
+
+		benchmark::DoNotOptimize(rotations.data());
+		benchmark::ClobberMemory();
+	}
+
+	ReportPerElement(state, matrices.size());
+}
+
+/* Matrix4SoA.inl */
+/* The eight lane kernels, per matrix, against the Matrix4 throughput benchmarks */
+template<typename Operation>
+static void RunLanesBenchmark(benchmark::State& state, Operation operation) noexcept
+{
+	const std::vector<CinMath::Matrix4> matrices{ RandomMatrices(ArrayLength(state)) };
+	std::vector<float> lanes(CinMath::MatrixLanesLength(matrices.size()));
+	std::vector<float> output(lanes.size());
+	CinMath::TransposeArray(matrices.data(), lanes.data(), matrices.size());
+
+	for (const auto _ : state)
+	{
+		for (std::size_t block{ 0U }; block < lanes.size(); block += 16U * CinMath::MatrixLaneWidth)
+			operation(CinMath::Matrix4SoA::Load(lanes.data() + block)).Store(output.data() + block);
+
+		benchmark::DoNotOptimize(output.data());
+		benchmark::ClobberMemory();
+	}
+
+	ReportPerElement(state, matrices.size());
+}
+
+static void BM_Matrix4SoAMultiplyThroughput(benchmark::State& state) noexcept
+{
+	CinMath::Matrix4SoA rhs;
+	for (std::size_t lane{ 0U }; lane < CinMath::MatrixLaneWidth; ++lane)
+		rhs.Set(lane, RandomMatrices(1U)[0]);
+
+	RunLanesBenchmark(state, [&rhs](const CinMath::Matrix4SoA& matrices) noexcept { return matrices * rhs; });
+}
+
+static void BM_Matrix4SoAInverseThroughput(benchmark::State& state) noexcept
+{
+	RunLanesBenchmark(state, [](const CinMath::Matrix4SoA& matrices) noexcept { return CinMath::Inverse(matrices); });
+}
+
+/* Vector4.inl */
+static void BM_Vector4AdditionLatency(benchmark::State& state) noexcept
+{
+	const CinMath::Vector4 offset{ 1.0f, 2.0f, 3.0f, 4.0f };
+	RunLatencyBenchmark(state, RandomVectors(1U)[0], [&offset](const CinMath::Vector4& vector) noexcept { return vector + offset; });
+}
+
+static void BM_Vector4AdditionThroughput(benchmark::State& state) noexcept
+{
+	const CinMath::Vector4 offset{ 1.0f, 2.0f, 3.0f, 4.0f };
+	RunThroughputBenchmark(state, RandomVectors(ArrayLength(state)), [&offset](const CinMath::Vector4& vector) noexcept { return vector + offset; });
+}
+
+/* Transform.inl, the scalar results (Dot, Length) are broadcast back into a vector to continue the chain */
+static void BM_Vector4DotLatency(benchmark::State& state) noexcept
+{
+	/* The weights sum to one, every vector (a, a, a, a) is a fixed point of the chain */
+	const CinMath::Vector4 weights{ 0.25f, 0.25f, 0.25f, 0.25f };
+	RunLatencyBenchmark(state, CinMath::Vector4{ 0.5f }, [&weights](const CinMath::Vector4& vector) noexcept { return CinMath::Vector4{ CinMath::Dot(vector, weights) }; });
+}
+
+static void BM_Vector4DotThroughput(benchmark::State& state) noexcept
+{
+	const CinMath::Vector4 direction{ 0.5f, 0.5f, 0.5f, 0.5f };
+	RunThroughputBenchmark(state, RandomVectors(ArrayLength(state)), [&direction](const CinMath::Vector4& vector) noexcept { return CinMath::Dot(vector, direction); });
+}
+
+static void BM_Vector4LengthLatency(benchmark::State& state) noexcept
+{
+	/* Length(a, a, a, a) is 2a, halved so the chain stays at its fixed point */
+	RunLatencyBenchmark(state, CinMath::Vector4{ 0.5f }, [](const CinMath::Vector4& vector) noexcept { return CinMath::Vector4{ CinMath::Length(vector) * 0.5f }; });
+}
+
+static void BM_Vector4LengthThroughput(benchmark::State& state) noexcept
+{
+	RunThroughputBenchmark(state, RandomVectors(ArrayLength(state)), [](const CinMath::Vector4& vector) noexcept { return CinMath::Length(vector); });
+}
+
+static void BM_Vector4NormalizeLatency(benchmark::State& state) noexcept
+{
+	RunLatencyBenchmark(state, RandomVectors(1U)[0], [](const CinMath::Vector4& vector) noexcept { return CinMath::Normalize(vector); });
+}
+
+static void BM_Vector4NormalizeThroughput(benchmark::State& state) noexcept
+{
+	RunThroughputBenchmark(state, RandomVectors(ArrayLength(state)), [](const CinMath::Vector4& vector) noexcept { return CinMath::Normalize(vector); });
+}
+
+static void BM_Vector4NormalizeFastLatency(benchmark::State& state) noexcept
+{
+	RunLatencyBenchmark(state, RandomVectors(1U)[0], [](const CinMath::Vector4& vector) noexcept { return CinMath::NormalizeFast(vector); });
+}
+
+static void BM_Vector4NormalizeFastThroughput(benchmark::State& state) noexcept
+{
+	RunThroughputBenchmark(state, RandomVectors(ArrayLength(state)), [](const CinMath::Vector4& vector) noexcept { return CinMath::NormalizeFast(vector); });
+}
+
+static void BM_Matrix4TransposeLatency(benchmark::State& state) noexcept
+{
+	RunLatencyBenchmark(state, RandomMatrices(1U)[0], [](const CinMath::Matrix4& matrix) noexcept { return CinMath::Transpose(matrix); });
+}
+
+static void BM_Matrix4TransposeThroughput(benchmark::State& state) noexcept
+{
+	RunThroughputBenchmark(state, RandomMatrices(ArrayLength(state)), [](const CinMath::Matrix4& matrix) noexcept { return CinMath::Transpose(matrix); });
+}
+
+/* Inverting twice gives the input back, the chain stays well conditioned */
+static void BM_Matrix4InverseLatency(benchmark::State& state) noexcept
+{
+	RunLatencyBenchmark(state, RandomMatrices(1U)[0], [](const CinMath::Matrix4& matrix) noexcept { return CinMath::Inverse(matrix); });
+}
+
+static void BM_Matrix4InverseThroughput(benchmark::State& state) noexcept
+{
+	RunThroughputBenchmark(state, RandomMatrices(ArrayLength(state)), [](const CinMath::Matrix4& matrix) noexcept { return CinMath::Inverse(matrix); });
 }
 
 BENCHMARK(BM_Matrix4x4Multiplication);
-BENCHMARK_MAIN();
\ No newline at end of file
+BENCHMARK(BM_Matrix4MultiplyLatency);
+BENCHMARK(BM_Matrix4MultiplyThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_Matrix4VectorLatency);
+BENCHMARK(BM_Matrix4VectorThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_TransformPointsBatch<false>)->Apply(ThroughputSizes);
+BENCHMARK(BM_Vector4MatrixThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_TransformPointsBatch<true>)->Apply(ThroughputSizes);
+BENCHMARK(BM_TransposeArrayToLanes)->Apply(ThroughputSizes);
+BENCHMARK(BM_Vector4AdditionLatency);
+BENCHMARK(BM_Vector4AdditionThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_Vector4DotLatency);
+BENCHMARK(BM_Vector4DotThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_Vector4LengthLatency);
+BENCHMARK(BM_Vector4LengthThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_Vector4NormalizeLatency);
+BENCHMARK(BM_Vector4NormalizeThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_Vector4NormalizeFastLatency);
+BENCHMARK(BM_Vector4NormalizeFastThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_Matrix4TransposeLatency);
+BENCHMARK(BM_Matrix4TransposeThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_Matrix4InverseLatency);
+BENCHMARK(BM_Matrix4InverseThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_Matrix4SoAMultiplyThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_Matrix4SoAInverseThroughput)->Apply(ThroughputSizes);
+BENCHMARK(BM_DecomposeArray<false>)->Apply(ThroughputSizes);
+BENCHMARK(BM_DecomposeArray<true>)->Apply(ThroughputSizes);
+BENCHMARK_MAIN();
@@ -0,0 +1,110 @@
+"""Compares Google Benchmark JSON results against stored baselines.
+
+Every <tier>.json in the current directory is matched with the file of the same name in the baseline
+directory and every benchmark is compared by name. Throughput (items_per_second) is used when both runs
+report it, the real time otherwise. The script exits with 1 when a benchmark got slower than the threshold.
+
+    python CompareBenchmarks.py --baseline BenchmarkResults --current build/BenchmarkResults --threshold 10
+    python CompareBenchmarks.py --baseline BenchmarkResults --current build/BenchmarkResults --update
+"""
+import argparse
+import json
+import pathlib
+import shutil
+import sys
+
+TIME_UNITS = { "ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9 }
+
+def load_benchmarks(path):
+    """Returns the context and { name: benchmark } of a result file, repeated runs reduced to their median"""
+    with open(path) as file:
+        data = json.load(file)
+
+    iterations = {}
+    medians = {}
+    for benchmark in data.get("benchmarks", []):
+        name = benchmark.get("run_name", benchmark["name"])
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") == "median":
+                medians[name] = benchmark
+        else:
+            iterations.setdefault(name, []).append(benchmark)
+
+    benchmarks = dict(medians)
+    for name, runs in iterations.items():
+        if name not in benchmarks:
+            runs = sorted(runs, key = lambda run: run["real_time"] * TIME_UNITS[run.get("time_unit", "ns")])
+            benchmarks[name] = runs[len(runs) // 2]
+
+    return data.get("context", {}), benchmarks
+
+def slowdown(baseline, current):
+    """Returns (relative slowdown in percent, metric description), positive means slower"""
+    if "items_per_second" in baseline and "items_per_second" in current:
+        return (baseline["items_per_second"] / current["items_per_second"] - 1.0) * 100.0, "items/s"
+
+    baselineTime = baseline["real_time"] * TIME_UNITS[baseline.get("time_unit", "ns")]
+    currentTime = current["real_time"] * TIME_UNITS[current.get("time_unit", "ns")]
+    return (currentTime / baselineTime - 1.0) * 100.0, "time"
+
+def compare(baselinePath, currentPath, threshold):
+    """Prints the comparison of one tier, returns the number of regressions"""
+    baselineContext, baseline = load_benchmarks(baselinePath)
+    currentContext, current = load_benchmarks(currentPath)
+
+    print(f"\n{currentPath.stem}")
+    for key in ("host_name", "num_cpus", "mhz_per_cpu"):
+        if baselineContext.get(key) != currentContext.get(key):
+            print(f"  warning: {key} differs ({baselineContext.get(key)} -> {currentContext.get(key)}), the numbers may not be comparable")
+
+    regressions = 0
+    for name in sorted(set(baseline) | set(current)):
+        if name not in current:
+            print(f"  {name:<60} missing from the current run")
+            continue
+
+        if name not in baseline:
+            print(f"  {name:<60} new, no baseline")
+            continue
+
+        change, metric = slowdown(baseline[name], current[name])
+        regressed = change > threshold
+        regressions += regressed
+        verdict = "REGRESSION" if regressed else ("faster" if change < -threshold else "ok")
+        print(f"  {name:<60} {change:+8.2f}% ({metric}) {verdict}")
+
+    return regressions
+
+def main():
+    parser = argparse.ArgumentParser(description = "Compares benchmark results against stored baselines")
+    parser.add_argument("--baseline", type = pathlib.Path, required = True, help = "directory of the baseline <tier>.json files")
+    parser.add_argument("--current", type = pathlib.Path, required = True, help = "directory of the current <tier>.json files")
+    parser.add_argument("--threshold", type = float, default = 10.0, help = "slowdown in percent reported as a regression")
+    parser.add_argument("--update", action = "store_true", help = "copies the current results over the baselines instead of comparing")
+    arguments = parser.parse_args()
+
+    currentFiles = sorted(arguments.current.glob("*.json"))
+    if not currentFiles:
+        print(f"No results in {arguments.current}, run the BenchmarkRun target first")
+        return 2
+
+    if arguments.update:
+        for path in currentFiles:
+            shutil.copyfile(path, arguments.baseline / path.name)
+            print(f"Updated {arguments.baseline / path.name}")
+        return 0
+
+    regressions = 0
+    for path in currentFiles:
+        baselinePath = arguments.baseline / path.name
+        if not baselinePath.exists():
+            print(f"\n{path.stem}\n  no baseline, skipped (store one with --update)")
+            continue
+
+        regressions += compare(baselinePath, path, arguments.threshold)
+
+    print(f"\n{regressions} regression(s) beyond {arguments.threshold}%")
+    return 1 if regressions else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,614 @@
+#pragma once
+/* Opt-in: binary container for arrays of vectors, matrices and quaternions, read back through a memory mapping.
+ * Include after (or instead of) CinMath.h */
+#include "CinMath.h"
+
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <span>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CinMath {
+	/* The payload is the in-memory representation, which is only the file format on little endian hosts */
+	static_assert(std::endian::native == std::endian::little, "Archives are little endian");
+
+	enum class ArchiveElementType : std::uint32_t
+	{
+		Vector3Float = 1U,
+		Vector4Float = 2U,
+		Matrix4Float = 3U,
+		QuaternionFloat = 4U,
+		Vector3Double = 5U,
+		Vector4Double = 6U,
+		Matrix4Double = 7U,
+		QuaternionDouble = 8U
+	};
+
+	enum class ArchiveLayout : std::uint32_t
+	{
+		/* Elements stored back to back, element i at payload + i * sizeof(element) */
+		ArrayOfStructures = 0U,
+		/* One plane per component, component c of element i at payload + c * PlaneStride + i * sizeof(value) */
+		StructureOfArrays = 1U
+	};
+
+	enum class ArchiveAccess : std::uint32_t
+	{
+		ReadOnly = 0U,
+		/* Private mapping: pages are copied on first write, the file itself is never modified */
+		CopyOnWrite = 1U
+	};
+
+	enum class ArchiveStatus : std::uint32_t
+	{
+		Success = 0U,
+		CannotOpen,
+		CannotMap,
+		CannotWrite,
+		InvalidHeader,
+		UnsupportedVersion,
+		Truncated,
+		ChecksumMismatch
+	};
+
+	/* File header, the payload starts at PayloadOffset which is a multiple of ArchiveAlignment */
+	struct ArchiveHeader final
+	{
+		static constexpr char ExpectedMagic[8]{ 'C', 'I', 'N', 'M', 'A', 'T', 'H', '\0' };
+		static constexpr std::uint32_t CurrentVersion{ 1U };
+
+		char Magic[8];
+		std::uint32_t Version;
+		ArchiveElementType ElementType;
+		ArchiveLayout Layout;
+		std::uint32_t ComponentCount;
+		std::uint64_t Count;
+		std::uint64_t PayloadOffset;
+		std::uint64_t PayloadSize;
+		/* Distance in bytes between the planes of a StructureOfArrays payload, 0 otherwise */
+		std::uint64_t PlaneStride;
+		/* Checksum of the PayloadSize bytes of the payload, see Implementation::ArchiveChecksum */
+		std::uint64_t Checksum;
+	};
+
+	/* Alignment of the payload and of every plane, one cache line */
+	constexpr std::size_t ArchiveAlignment{ 64U };
+
+	static_assert(sizeof(ArchiveHeader) == ArchiveAlignment && std::is_trivially_copyable_v<ArchiveHeader>, "The archive header is one cache line");
+
+	/* Element types an archive can hold */
+	template<typename T>
+	struct ArchiveElement;
+
+	template<typename ValueType>
+	struct ArchiveElement<Vector<3, ValueType>> final
+	{
+		typedef ValueType Value;
+		static constexpr ArchiveElementType Type{ std::is_same_v<ValueType, float> ? ArchiveElementType::Vector3Float : ArchiveElementType::Vector3Double };
+		static constexpr std::uint32_t ComponentCount{ 3U };
+	};
+
+	template<typename ValueType>
+	struct ArchiveElement<Vector<4, ValueType>> final
+	{
+		typedef ValueType Value;
+		static constexpr ArchiveElementType Type{ std::is_same_v<ValueType, float> ? ArchiveElementType::Vector4Float : ArchiveElementType::Vector4Double };
+		static constexpr std::uint32_t ComponentCount{ 4U };
+	};
+
+	template<typename ValueType>
+	struct ArchiveElement<Matrix<4, 4, ValueType>> final
+	{
+		typedef ValueType Value;
+		static constexpr ArchiveElementType Type{ std::is_same_v<ValueType, float> ? ArchiveElementType::Matrix4Float : ArchiveElementType::Matrix4Double };
+		static constexpr std::uint32_t ComponentCount{ 16U };
+	};
+
+	template<typename ValueType>
+	struct ArchiveElement<TQuaternion<ValueType>> final
+	{
+		typedef ValueType Value;
+		static constexpr ArchiveElementType Type{ std::is_same_v<ValueType, float> ? ArchiveElementType::QuaternionFloat : ArchiveElementType::QuaternionDouble };
+		static constexpr std::uint32_t ComponentCount{ 4U };
+	};
+
+	template<typename T>
+	concept ArchivableType = requires
+	{
+		typename ArchiveElement<T>::Value;
+	} && (std::is_same_v<typename ArchiveElement<T>::Value, float> || std::is_same_v<typename ArchiveElement<T>::Value, double>)
+		&& sizeof(T) == ArchiveElement<T>::ComponentCount * sizeof(typename ArchiveElement<T>::Value)
+		&& std::is_trivially_copyable_v<T>;
+
+	namespace Implementation {
+		/**
+		 * 64 bit checksum in four independent lanes of 8 bytes (the xxHash64 round and avalanche), a few bytes
+		 * per cycle so verifying a multi gigabyte cache costs far less than reading it from disk
+		 */
+		class ArchiveChecksum final
+		{
+		public:
+			ArchiveChecksum() noexcept
+				:
+				m_Lanes{ Prime1 + Prime2, Prime2, 0U, 0U - Prime1 },
+				m_Buffered(0U),
+				m_Size(0U)
+			{}
+
+			void Update(const void* const data, std::size_t size) noexcept
+			{
+				const unsigned char* bytes{ static_cast<const unsigned char*>(data) };
+				m_Size += size;
+
+				if (m_Buffered != 0U)
+				{
+					const std::size_t taken{ std::min(size, sizeof(m_Buffer) - m_Buffered) };
+					std::memcpy(m_Buffer + m_Buffered, bytes, taken);
+					m_Buffered += taken;
+					bytes += taken;
+					size -= taken;
+					if (m_Buffered < sizeof(m_Buffer))
+						return;
+
+					Consume(m_Buffer);
+					m_Buffered = 0U;
+				}
+
+				for (; size >= sizeof(m_Buffer); bytes += sizeof(m_Buffer), size -= sizeof(m_Buffer))
+					Consume(bytes);
+
+				std::memcpy(m_Buffer, bytes, size);
+				m_Buffered = size;
+			}
+
+			[[nodiscard]] std::uint64_t Finish() const noexcept
+			{
+				std::uint64_t hash{ m_Size >= sizeof(m_Buffer)
+					? std::rotl(m_Lanes[0], 1) + std::rotl(m_Lanes[1], 7) + std::rotl(m_Lanes[2], 12) + std::rotl(m_Lanes[3], 18)
+					: m_Lanes[2] + Prime5 };
+				hash += m_Size;
+
+				std::size_t i{ 0U };
+				for (; i + 8U <= m_Buffered; i += 8U)
+					hash = std::rotl(hash ^ Round(0U, Load(m_Buffer + i)), 27) * Prime1 + Prime4;
+
+				for (; i < m_Buffered; ++i)
+					hash = std::rotl(hash ^ (m_Buffer[i] * Prime5), 11) * Prime1;
+
+				hash ^= hash >> 33U;
+				hash *= Prime2;
+				hash ^= hash >> 29U;
+				hash *= Prime3;
+				return hash ^ (hash >> 32U);
+			}
+		private:
+			static constexpr std::uint64_t Prime1{ 0x9E37'79B1'85EB'CA87ULL };
+			static constexpr std::uint64_t Prime2{ 0xC2B2'AE3D'27D4'EB4FULL };
+			static constexpr std::uint64_t Prime3{ 0x1656'67B1'9E37'79F9ULL };
+			static constexpr std::uint64_t Prime4{ 0x85EB'CA77'C2B2'AE63ULL };
+			static constexpr std::uint64_t Prime5{ 0x27D4'EB2F'1656'67C5ULL };
+
+			static std::uint64_t Load(const unsigned char* const bytes) noexcept
+			{
+				std::uint64_t value;
+				std::memcpy(&value, bytes, sizeof(value));
+				return value;
+			}
+
+			static std::uint64_t Round(const std::uint64_t lane, const std::uint64_t value) noexcept
+			{
+				return std::rotl(lane + value * Prime2, 31) * Prime1;
+			}
+
+			void Consume(const unsigned char* const bytes) noexcept
+			{
+				m_Lanes[0] = Round(m_Lanes[0], Load(bytes));
+				m_Lanes[1] = Round(m_Lanes[1], Load(bytes + 8U));
+				m_Lanes[2] = Round(m_Lanes[2], Load(bytes + 16U));
+				m_Lanes[3] = Round(m_Lanes[3], Load(bytes + 24U));
+			}
+		private:
+			std::uint64_t m_Lanes[4];
+			unsigned char m_Buffer[32];
+			std::size_t m_Buffered;
+			std::uint64_t m_Size;
+		};
+
+		constexpr std::uint64_t ArchiveAlignUp(const std::uint64_t size) noexcept
+		{
+			return (size + (ArchiveAlignment - 1U)) & ~static_cast<std::uint64_t>(ArchiveAlignment - 1U);
+		}
+
+		constexpr std::uint32_t ArchiveComponentCount(const ArchiveElementType type) noexcept
+		{
+			switch (type)
+			{
+			case ArchiveElementType::Vector3Float:
+			case ArchiveElementType::Vector3Double:
+				return 3U;
+			case ArchiveElementType::Vector4Float:
+			case ArchiveElementType::Vector4Double:
+			case ArchiveElementType::QuaternionFloat:
+			case ArchiveElementType::QuaternionDouble:
+				return 4U;
+			case ArchiveElementType::Matrix4Float:
+			case ArchiveElementType::Matrix4Double:
+				return 16U;
+			}
+
+			return 0U;
+		}
+
+		constexpr std::uint64_t ArchiveValueSize(const ArchiveElementType type) noexcept
+		{
+			return static_cast<std::uint32_t>(type) <= static_cast<std::uint32_t>(ArchiveElementType::QuaternionFloat) ? sizeof(float) : sizeof(double);
+		}
+
+		template<typename T>
+		ArchiveHeader MakeArchiveHeader(const ArchiveLayout layout, const std::size_t count) noexcept
+		{
+			typedef ArchiveElement<T> Element;
+
+			ArchiveHeader header{};
+			std::memcpy(header.Magic, ArchiveHeader::ExpectedMagic, sizeof(header.Magic));
+			header.Version = ArchiveHeader::CurrentVersion;
+			header.ElementType = Element::Type;
+			header.Layout = layout;
+			header.ComponentCount = Element::ComponentCount;
+			header.Count = count;
+			header.PayloadOffset = ArchiveAlignment;
+			if (layout == ArchiveLayout::StructureOfArrays)
+			{
+				header.PlaneStride = ArchiveAlignUp(static_cast<std::uint64_t>(count) * sizeof(typename Element::Value));
+				header.PayloadSize = header.PlaneStride * Element::ComponentCount;
+			}
+			else
+			{
+				header.PlaneStride = 0U;
+				header.PayloadSize = static_cast<std::uint64_t>(count) * sizeof(T);
+			}
+
+			return header;
+		}
+
+		/* Writes the header, then the payload chunks, then rewrites the header with the checksum of the payload */
+		template<typename WritePayload>
+		ArchiveStatus WriteArchiveFile(const char* const path, ArchiveHeader header, WritePayload&& writePayload) noexcept
+		{
+			std::FILE* const file{ std::fopen(path, "wb") };
+			if (!file)
+				return ArchiveStatus::CannotOpen;
+
+			ArchiveChecksum checksum;
+			bool success{ std::fwrite(&header, sizeof(header), 1U, file) == 1U };
+			success = success && writePayload([file, &checksum](const void* const data, const std::size_t size) noexcept
+			{
+				checksum.Update(data, size);
+				return size == 0U || std::fwrite(data, size, 1U, file) == 1U;
+			});
+
+			header.Checksum = checksum.Finish();
+			success = success && std::fseek(file, 0L, SEEK_SET) == 0 && std::fwrite(&header, sizeof(header), 1U, file) == 1U;
+			success = (std::fclose(file) == 0) && success;
+			return success ? ArchiveStatus::Success : ArchiveStatus::CannotWrite;
+		}
+	}
+
+	/**
+	 * Writes elements stored back to back
+	 *
+	 * @param input path of the file, overwritten
+	 * @param input elements
+	 * @param input number of elements
+	 * @return Success or the reason of the failure
+	 */
+	template<ArchivableType T>
+	ArchiveStatus WriteArchive(const char* const path, const T* const elements, const std::size_t count) noexcept
+	{
+		return Implementation::WriteArchiveFile(path, Implementation::MakeArchiveHeader<T>(ArchiveLayout::ArrayOfStructures, count), [elements, count](auto&& write) noexcept
+		{
+			return write(elements, count * sizeof(T));
+		});
+	}
+
+	/**
+	 * Writes elements stored as one array per component (x[], y[], z[], ... or the 16 matrix entries in memory order)
+	 *
+	 * @param input path of the file, overwritten
+	 * @param input ArchiveElement<T>::ComponentCount component arrays of count values each
+	 * @param input number of elements
+	 * @return Success or the reason of the failure
+	 */
+	template<ArchivableType T>
+	ArchiveStatus WriteArchivePlanes(const char* const path, const typename ArchiveElement<T>::Value* const* const planes, const std::size_t count) noexcept
+	{
+		typedef typename ArchiveElement<T>::Value Value;
+
+		const ArchiveHeader header{ Implementation::MakeArchiveHeader<T>(ArchiveLayout::StructureOfArrays, count) };
+		return Implementation::WriteArchiveFile(path, header, [planes, count, &header](auto&& write) noexcept
+		{
+			static constexpr unsigned char padding[ArchiveAlignment]{};
+			const std::size_t paddingSize{ static_cast<std::size_t>(header.PlaneStride - count * sizeof(Value)) };
+
+			bool success{ true };
+			for (std::uint32_t component{ 0U }; success && component < ArchiveElement<T>::ComponentCount; ++component)
+				success = write(planes[component], count * sizeof(Value)) && write(padding, paddingSize);
+
+			return success;
+		});
+	}
+
+	/**
+	 * Read-only view of an archive file. The file is mapped, not read: pages are loaded on first access and the
+	 * spans point straight into the mapping, so they are valid until the archive is closed or destroyed. The
+	 * payload is aligned to ArchiveAlignment which satisfies the alignment of every element type
+	 */
+	class MappedArchive final
+	{
+	public:
+		MappedArchive() noexcept
+			:
+			m_Mapping(nullptr),
+			m_MappingSize(0U),
+			m_Header{},
+			m_Access(ArchiveAccess::ReadOnly)
+		{}
+
+		MappedArchive(const MappedArchive&) = delete;
+		MappedArchive& operator=(const MappedArchive&) = delete;
+
+		MappedArchive(MappedArchive&& other) noexcept
+			:
+			m_Mapping(std::exchange(other.m_Mapping, nullptr)),
+			m_MappingSize(std::exchange(other.m_MappingSize, 0U)),
+			m_Header(other.m_Header),
+			m_Access(other.m_Access)
+		{}
+
+		MappedArchive& operator=(MappedArchive&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Close();
+				m_Mapping = std::exchange(other.m_Mapping, nullptr);
+				m_MappingSize = std::exchange(other.m_MappingSize, 0U);
+				m_Header = other.m_Header;
+				m_Access = other.m_Access;
+			}
+
+			return *this;
+		}
+
+		~MappedArchive() noexcept
+		{
+			Close();
+		}
+
+		/**
+		 * Maps an archive, closing the one currently open
+		 *
+		 * @param input path of the file
+		 * @param input ReadOnly, or CopyOnWrite to let the batch kernels work in place on the mapped data
+		 * @param input reads the whole payload to compare its checksum, skip it for trusted files to keep the
+		 *		  open O(1) and fault the pages in lazily
+		 * @return Success or the reason of the failure, the archive stays closed on failure
+		 */
+		ArchiveStatus Open(const char* const path, const ArchiveAccess access = ArchiveAccess::ReadOnly, const bool verifyChecksum = true) noexcept
+		{
+			Close();
+
+			const ArchiveStatus status{ Map(path, access) };
+			if (status != ArchiveStatus::Success)
+				return status;
+
+			const ArchiveStatus validation{ Validate(verifyChecksum) };
+			if (validation != ArchiveStatus::Success)
+				Close();
+
+			return validation;
+		}
+
+		void Close() noexcept
+		{
+			if (!m_Mapping)
+				return;
+
+#if defined(_WIN32)
+			UnmapViewOfFile(m_Mapping);
+#else
+			munmap(m_Mapping, m_MappingSize);
+#endif
+			m_Mapping = nullptr;
+			m_MappingSize = 0U;
+			m_Header = ArchiveHeader{};
+		}
+
+		[[nodiscard]] bool IsOpen() const noexcept
+		{
+			return m_Mapping != nullptr;
+		}
+
+		[[nodiscard]] const ArchiveHeader& GetHeader() const noexcept
+		{
+			return m_Header;
+		}
+
+		/**
+		 * @return the elements of an ArrayOfStructures archive of T, empty when the archive holds something else
+		 */
+		template<ArchivableType T>
+		[[nodiscard]] std::span<const T> GetElements() const noexcept
+		{
+			if (!Holds<T>(ArchiveLayout::ArrayOfStructures))
+				return {};
+
+			return { reinterpret_cast<const T*>(GetPayload()), static_cast<std::size_t>(m_Header.Count) };
+		}
+
+		/**
+		 * @return the elements of an ArrayOfStructures archive of T, empty unless the archive was opened copy-on-write
+		 */
+		template<ArchivableType T>
+		[[nodiscard]] std::span<T> GetMutableElements() noexcept
+		{
+			if (m_Access != ArchiveAccess::CopyOnWrite || !Holds<T>(ArchiveLayout::ArrayOfStructures))
+				return {};
+
+			return { reinterpret_cast<T*>(GetPayload()), static_cast<std::size_t>(m_Header.Count) };
+		}
+
+		/**
+		 * @param input component index, less than ArchiveElement<T>::ComponentCount
+		 * @return the values of one component of a StructureOfArrays archive of T, empty when the archive holds something else
+		 */
+		template<ArchivableType T>
+		[[nodiscard]] std::span<const typename ArchiveElement<T>::Value> GetPlane(const std::uint32_t component) const noexcept
+		{
+			if (!Holds<T>(ArchiveLayout::StructureOfArrays) || component >= ArchiveElement<T>::ComponentCount)
+				return {};
+
+			return { reinterpret_cast<const typename ArchiveElement<T>::Value*>(GetPayload() + component * m_Header.PlaneStride), static_cast<std::size_t>(m_Header.Count) };
+		}
+
+		/**
+		 * @param input component index, less than ArchiveElement<T>::ComponentCount
+		 * @return the values of one component of a StructureOfArrays archive of T, empty unless the archive was opened copy-on-write
+		 */
+		template<ArchivableType T>
+		[[nodiscard]] std::span<typename ArchiveElement<T>::Value> GetMutablePlane(const std::uint32_t component) noexcept
+		{
+			if (m_Access != ArchiveAccess::CopyOnWrite || !Holds<T>(ArchiveLayout::StructureOfArrays) || component >= ArchiveElement<T>::ComponentCount)
+				return {};
+
+			return { reinterpret_cast<typename ArchiveElement<T>::Value*>(GetPayload() + component * m_Header.PlaneStride), static_cast<std::size_t>(m_Header.Count) };
+		}
+	private:
+		unsigned char* GetPayload() const noexcept
+		{
+			return static_cast<unsigned char*>(m_Mapping) + m_Header.PayloadOffset;
+		}
+
+		template<typename T>
+		bool Holds(const ArchiveLayout layout) const noexcept
+		{
+			return m_Mapping && m_Header.ElementType == ArchiveElement<T>::Type && m_Header.Layout == layout;
+		}
+
+		ArchiveStatus Map(const char* const path, const ArchiveAccess access) noexcept
+		{
+#if defined(_WIN32)
+			const HANDLE file{ CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+			if (file == INVALID_HANDLE_VALUE)
+				return ArchiveStatus::CannotOpen;
+
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(file, &size) || static_cast<std::uint64_t>(size.QuadPart) < sizeof(ArchiveHeader))
+			{
+				CloseHandle(file);
+				return ArchiveStatus::InvalidHeader;
+			}
+
+			/* The view keeps the mapping object and the file alive once it exists */
+			const HANDLE mapping{ CreateFileMappingA(file, nullptr, access == ArchiveAccess::CopyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0U, 0U, nullptr) };
+			CloseHandle(file);
+			if (!mapping)
+				return ArchiveStatus::CannotMap;
+
+			void* const view{ MapViewOfFile(mapping, access == ArchiveAccess::CopyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0U, 0U, 0U) };
+			CloseHandle(mapping);
+			if (!view)
+				return ArchiveStatus::CannotMap;
+#else
+			const int file{ ::open(path, O_RDONLY) };
+			if (file < 0)
+				return ArchiveStatus::CannotOpen;
+
+			struct stat status;
+			if (::fstat(file, &status) != 0 || static_cast<std::uint64_t>(status.st_size) < sizeof(ArchiveHeader))
+			{
+				::close(file);
+				return ArchiveStatus::InvalidHeader;
+			}
+
+			const std::size_t size{ static_cast<std::size_t>(status.st_size) };
+			void* const view{ ::mmap(nullptr, size, access == ArchiveAccess::CopyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ, MAP_PRIVATE, file, 0) };
+			::close(file);
+			if (view == MAP_FAILED)
+				return ArchiveStatus::CannotMap;
+#endif
+			m_Mapping = view;
+#if defined(_WIN32)
+			m_MappingSize = static_cast<std::size_t>(size.QuadPart);
+#else
+			m_MappingSize = size;
+#endif
+			m_Access = access;
+			std::memcpy(&m_Header, m_Mapping, sizeof(m_Header));
+			return ArchiveStatus::Success;
+		}
+
+		ArchiveStatus Validate(const bool verifyChecksum) const noexcept
+		{
+			if (std::memcmp(m_Header.Magic, ArchiveHeader::ExpectedMagic, sizeof(m_Header.Magic)) != 0)
+				return ArchiveStatus::InvalidHeader;
+
+			if (m_Header.Version != ArchiveHeader::CurrentVersion)
+				return ArchiveStatus::UnsupportedVersion;
+
+			const std::uint32_t componentCount{ Implementation::ArchiveComponentCount(m_Header.ElementType) };
+			if (componentCount == 0U || componentCount != m_Header.ComponentCount || m_Header.PayloadOffset < sizeof(ArchiveHeader) || m_Header.PayloadOffset % ArchiveAlignment != 0U)
+				return ArchiveStatus::InvalidHeader;
+
+			/* The sizes must follow from the count, which also keeps every span inside the payload */
+			const std::uint64_t valueSize{ Implementation::ArchiveValueSize(m_Header.ElementType) };
+			if (m_Header.Count > (std::numeric_limits<std::uint64_t>::max() / 2U) / (valueSize * componentCount))
+				return ArchiveStatus::InvalidHeader;
+
+			if (m_Header.Layout == ArchiveLayout::ArrayOfStructures)
+			{
+				if (m_Header.PlaneStride != 0U || m_Header.PayloadSize != m_Header.Count * valueSize * componentCount)
+					return ArchiveStatus::InvalidHeader;
+			}
+			else if (m_Header.Layout == ArchiveLayout::StructureOfArrays)
+			{
+				if (m_Header.PlaneStride != Implementation::ArchiveAlignUp(m_Header.Count * valueSize) || m_Header.PayloadSize != m_Header.PlaneStride * componentCount)
+					return ArchiveStatus::InvalidHeader;
+			}
+			else
+				return ArchiveStatus::InvalidHeader;
+
+			if (m_Header.PayloadOffset > m_MappingSize || m_Header.PayloadSize > m_MappingSize - m_Header.PayloadOffset)
+				return ArchiveStatus::Truncated;
+
+			if (verifyChecksum)
+			{
+				Implementation::ArchiveChecksum checksum;
+				checksum.Update(GetPayload(), static_cast<std::size_t>(m_Header.PayloadSize));
+				if (checksum.Finish() != m_Header.Checksum)
+					return ArchiveStatus::ChecksumMismatch;
+			}
+
+			return ArchiveStatus::Success;
+		}
+	private:
+		void* m_Mapping;
+		std::size_t m_MappingSize;
+		ArchiveHeader m_Header;
+		ArchiveAccess m_Access;
+	};
+}
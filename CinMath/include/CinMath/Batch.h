@@ -0,0 +1,178 @@
+#pragma once
+
+namespace CinMath {
+	/**
+	 * Multiplies matrices pairwise, result[i] = lhs[i] * rhs[i]
+	 * 
+	 * @param input left hand side matrices
+	 * @param input right hand side matrices
+	 * @param output products, must not alias the inputs
+	 * @param input number of matrices
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void MultiplyArray(const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT lhs, const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT rhs, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT result, const std::size_t count) noexcept;
+
+	/**
+	 * Multiplies a matrix by every matrix of an array, result[i] = lhs * rhs[i]
+	 * 
+	 * @param input left hand side matrix
+	 * @param input right hand side matrices
+	 * @param output products, must not alias the inputs
+	 * @param input number of matrices
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void MultiplyArray(const Matrix<4, 4, ValueType>& lhs, const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT rhs, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT result, const std::size_t count) noexcept;
+
+	/**
+	 * Transforms points (or directions, w = 0) by a matrix, output[i] = matrix * input[i]. The matrix is loaded once
+	 * and every vector costs four broadcasts and multiply-adds, the SIMD tiers take two vectors per AVX register
+	 * 
+	 * @param input transformation matrix
+	 * @param input points
+	 * @param output transformed points, must not alias the input
+	 * @param input number of points
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void TransformPoints(const Matrix<4, 4, ValueType>& matrix, const Vector<4, ValueType>* CIN_MATH_RESTRICT input, Vector<4, ValueType>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Transforms row vectors by a matrix, output[i] = input[i] * matrix. Unlike a loop over operator*(Vector4, Matrix4)
+	 * the matrix is transposed once and every vector takes the broadcast path of TransformPoints
+	 * 
+	 * @param input transformation matrix
+	 * @param input points
+	 * @param output transformed points, must not alias the input
+	 * @param input number of points
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void TransformPointsTransposed(const Matrix<4, 4, ValueType>& matrix, const Vector<4, ValueType>* CIN_MATH_RESTRICT input, Vector<4, ValueType>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/*
+	 * Lane layout of matrix arrays for kernels that process eight matrices at once: the matrices are grouped in
+	 * blocks of MatrixLaneWidth and a block stores element (row, column) of its eight matrices next to each other,
+	 * so element e of matrix i is lanes[(i / 8) * 128 + e * 8 + i % 8]. Every run of eight values fills one AVX
+	 * register and a kernel works on whole blocks without shuffling lanes
+	 */
+	constexpr std::size_t MatrixLaneWidth{ 8U };
+
+	/**
+	 * Number of values of a lane layout array, the last block is padded with identity matrices
+	 *
+	 * @param input number of matrices
+	 * @return values in the lane layout
+	 */
+	constexpr std::size_t MatrixLanesLength(const std::size_t count) noexcept
+	{
+		return (count + MatrixLaneWidth - 1U) / MatrixLaneWidth * MatrixLaneWidth * 16U;
+	}
+
+	/**
+	 * Converts an array of matrices to the lane layout. Each block is two 8x8 transposes of the matrix elements
+	 * (four 4x4 transposes per half under SSE), the lanes past count are filled with identity matrices
+	 *
+	 * @param input matrices
+	 * @param output MatrixLanesLength(count) values, must not alias the input
+	 * @param input number of matrices
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void TransposeArray(const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, ValueType* CIN_MATH_RESTRICT lanes, const std::size_t count) noexcept;
+
+	/**
+	 * Converts the lane layout back to an array of matrices, the padding lanes are ignored
+	 *
+	 * @param input MatrixLanesLength(count) values
+	 * @param output matrices, must not alias the input
+	 * @param input number of matrices
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void TransposeArray(const ValueType* CIN_MATH_RESTRICT lanes, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, const std::size_t count) noexcept;
+
+	/**
+	 * Rotates vectors by a quaternion (in unit form)
+	 * 
+	 * @param input rotation
+	 * @param input vectors
+	 * @param output rotated vectors, must not alias the input
+	 * @param input number of vectors
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void RotateArray(const TQuaternion<ValueType>& rotation, const Vector<3, ValueType>* CIN_MATH_RESTRICT input, Vector<3, ValueType>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Normalizes vectors, output[i] = Normalize(input[i])
+	 * 
+	 * @param input vectors
+	 * @param output normalized vectors, may be the input
+	 * @param input number of vectors
+	 */
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE void NormalizeArray(const Vector<length, ValueType>* input, Vector<length, ValueType>* output, const std::size_t count) noexcept;
+
+	/**
+	 * Normalizes vectors with NormalizeFast, output[i] = NormalizeFast(input[i])
+	 * 
+	 * @param input vectors
+	 * @param output normalized vectors, may be the input
+	 * @param input number of vectors
+	 */
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE void NormalizeArrayFast(const Vector<length, ValueType>* input, Vector<length, ValueType>* output, const std::size_t count) noexcept;
+
+	/**
+	 * Normalizes three component vectors stored as separate x, y and z arrays, in place
+	 * 
+	 * @param input/output x components
+	 * @param input/output y components
+	 * @param input/output z components
+	 * @param input number of vectors
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void NormalizeArray(ValueType* CIN_MATH_RESTRICT x, ValueType* CIN_MATH_RESTRICT y, ValueType* CIN_MATH_RESTRICT z, const std::size_t count) noexcept;
+
+	/**
+	 * Normalizes three component vectors stored as separate x, y and z arrays, in place. The float SIMD paths use
+	 * a reciprocal square root estimate refined by one Newton-Raphson step, see NormalizeFast
+	 * 
+	 * @param input/output x components
+	 * @param input/output y components
+	 * @param input/output z components
+	 * @param input number of vectors
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void NormalizeArrayFast(ValueType* CIN_MATH_RESTRICT x, ValueType* CIN_MATH_RESTRICT y, ValueType* CIN_MATH_RESTRICT z, const std::size_t count) noexcept;
+
+	/**
+	 * Tests bounding spheres against a frustum
+	 * 
+	 * @param input six planes (xyz normal pointing inside, w distance), a point p is inside when dot(n, p) + w >= 0
+	 * @param input spheres (xyz center, w radius)
+	 * @param output visibility flags, 1 when the sphere intersects the frustum
+	 * @param input number of spheres
+	 * @return number of visible spheres
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE std::size_t CullSpheres(const std::array<Vector<4, ValueType>, 6>& planes, const Vector<4, ValueType>* CIN_MATH_RESTRICT spheres, std::uint8_t* CIN_MATH_RESTRICT visibility, const std::size_t count) noexcept;
+
+	/**
+	 * Splits affine matrices into translation, rotation and scale, see Decompose. Float matrices are decomposed eight
+	 * at a time: each block is transposed to a Matrix4SoA and decomposed with selects instead of branches
+	 *
+	 * @param input matrices, the scale components must not be zero
+	 * @param output translations
+	 * @param output rotations in unit form
+	 * @param output scales
+	 * @param input number of matrices
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void DecomposeArray(const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, Vector<3, ValueType>* CIN_MATH_RESTRICT translations, TQuaternion<ValueType>* CIN_MATH_RESTRICT rotations, Vector<3, ValueType>* CIN_MATH_RESTRICT scales, const std::size_t count) noexcept;
+
+	/**
+	 * Multiplies a chain of matrices in order, matrices[0] * matrices[1] * ... * matrices[count - 1]
+	 * 
+	 * @param input matrices
+	 * @param input number of matrices
+	 * @return product of the chain, identity for an empty chain
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE Matrix<4, 4, ValueType> MultiplyChain(const Matrix<4, 4, ValueType>* matrices, const std::size_t count) noexcept;
+}
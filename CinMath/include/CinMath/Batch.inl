@@ -0,0 +1,579 @@
+#pragma once
+
+namespace CinMath {
+	namespace Implementation {
+		template<typename ValueType>
+		struct BatchCullSpheres;
+
+		template<typename ValueType, bool fast>
+		struct BatchNormalizeSoA;
+
+		template<typename ValueType>
+		struct BatchTransformPoints;
+
+		template<typename ValueType>
+		struct BatchTransposeLanes;
+
+		template<typename ValueType>
+		struct BatchDecompose;
+
+		template<>
+		struct BatchCullSpheres<float> final
+		{
+			CIN_MATH_INLINE static std::size_t implementation(const std::array<Vector<4, float>, 6>& planes, const Vector<4, float>* CIN_MATH_RESTRICT spheres, std::uint8_t* CIN_MATH_RESTRICT visibility, const std::size_t count) noexcept
+			{
+				std::size_t visible{ 0U };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+				/* Planes transposed once, 6 planes + 2 duplicates fill the lanes */
+				const __m256 planeX{ _mm256_setr_ps(planes[0].x, planes[1].x, planes[2].x, planes[3].x, planes[4].x, planes[5].x, planes[5].x, planes[5].x) };
+				const __m256 planeY{ _mm256_setr_ps(planes[0].y, planes[1].y, planes[2].y, planes[3].y, planes[4].y, planes[5].y, planes[5].y, planes[5].y) };
+				const __m256 planeZ{ _mm256_setr_ps(planes[0].z, planes[1].z, planes[2].z, planes[3].z, planes[4].z, planes[5].z, planes[5].z, planes[5].z) };
+				const __m256 planeW{ _mm256_setr_ps(planes[0].w, planes[1].w, planes[2].w, planes[3].w, planes[4].w, planes[5].w, planes[5].w, planes[5].w) };
+
+				for (std::size_t i{ 0U }; i < count; ++i)
+				{
+					const __m128 sphere{ spheres[i].data };
+					const __m256 x{ _mm256_set_m128(_mm_shuffle_ps(sphere, sphere, 0b00'00'00'00), _mm_shuffle_ps(sphere, sphere, 0b00'00'00'00)) };
+					const __m256 y{ _mm256_set_m128(_mm_shuffle_ps(sphere, sphere, 0b01'01'01'01), _mm_shuffle_ps(sphere, sphere, 0b01'01'01'01)) };
+					const __m256 z{ _mm256_set_m128(_mm_shuffle_ps(sphere, sphere, 0b10'10'10'10), _mm_shuffle_ps(sphere, sphere, 0b10'10'10'10)) };
+					const __m256 radius{ _mm256_set_m128(_mm_shuffle_ps(sphere, sphere, 0b11'11'11'11), _mm_shuffle_ps(sphere, sphere, 0b11'11'11'11)) };
+
+					__m256 distance{ _mm256_add_ps(_mm256_mul_ps(planeX, x), planeW) };
+					distance = _mm256_add_ps(distance, _mm256_mul_ps(planeY, y));
+					distance = _mm256_add_ps(distance, _mm256_mul_ps(planeZ, z));
+					distance = _mm256_add_ps(distance, radius);
+
+					const std::uint8_t isVisible{ static_cast<std::uint8_t>(_mm256_movemask_ps(_mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_NGE_UQ)) == 0) };
+					visibility[i] = isVisible;
+					visible += isVisible;
+				}
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+				/* Planes 0-3 in the first register, 4-5 (duplicated) in the second */
+				const __m128 planeX0{ _mm_setr_ps(planes[0].x, planes[1].x, planes[2].x, planes[3].x) };
+				const __m128 planeY0{ _mm_setr_ps(planes[0].y, planes[1].y, planes[2].y, planes[3].y) };
+				const __m128 planeZ0{ _mm_setr_ps(planes[0].z, planes[1].z, planes[2].z, planes[3].z) };
+				const __m128 planeW0{ _mm_setr_ps(planes[0].w, planes[1].w, planes[2].w, planes[3].w) };
+				const __m128 planeX1{ _mm_setr_ps(planes[4].x, planes[5].x, planes[4].x, planes[5].x) };
+				const __m128 planeY1{ _mm_setr_ps(planes[4].y, planes[5].y, planes[4].y, planes[5].y) };
+				const __m128 planeZ1{ _mm_setr_ps(planes[4].z, planes[5].z, planes[4].z, planes[5].z) };
+				const __m128 planeW1{ _mm_setr_ps(planes[4].w, planes[5].w, planes[4].w, planes[5].w) };
+
+				for (std::size_t i{ 0U }; i < count; ++i)
+				{
+					const __m128 sphere{ spheres[i].data };
+					const __m128 x{ _mm_shuffle_ps(sphere, sphere, 0b00'00'00'00) };
+					const __m128 y{ _mm_shuffle_ps(sphere, sphere, 0b01'01'01'01) };
+					const __m128 z{ _mm_shuffle_ps(sphere, sphere, 0b10'10'10'10) };
+					const __m128 radius{ _mm_shuffle_ps(sphere, sphere, 0b11'11'11'11) };
+
+					__m128 distance0{ _mm_add_ps(_mm_mul_ps(planeX0, x), planeW0) };
+					distance0 = _mm_add_ps(distance0, _mm_mul_ps(planeY0, y));
+					distance0 = _mm_add_ps(distance0, _mm_mul_ps(planeZ0, z));
+					distance0 = _mm_add_ps(distance0, radius);
+
+					__m128 distance1{ _mm_add_ps(_mm_mul_ps(planeX1, x), planeW1) };
+					distance1 = _mm_add_ps(distance1, _mm_mul_ps(planeY1, y));
+					distance1 = _mm_add_ps(distance1, _mm_mul_ps(planeZ1, z));
+					distance1 = _mm_add_ps(distance1, radius);
+
+					const __m128 outside{ _mm_or_ps(_mm_cmpnge_ps(distance0, _mm_setzero_ps()), _mm_cmpnge_ps(distance1, _mm_setzero_ps())) };
+					const std::uint8_t isVisible{ static_cast<std::uint8_t>(_mm_movemask_ps(outside) == 0) };
+					visibility[i] = isVisible;
+					visible += isVisible;
+				}
+#else
+				for (std::size_t i{ 0U }; i < count; ++i)
+				{
+					const Vector<4, float>& sphere{ spheres[i] };
+
+					bool inside{ true };
+					for (const Vector<4, float>& plane : planes)
+						inside &= (plane.x * sphere.x + plane.w + plane.y * sphere.y + plane.z * sphere.z + sphere.w) >= 0.0f;
+
+					visibility[i] = static_cast<std::uint8_t>(inside);
+					visible += inside;
+				}
+#endif
+				return visible;
+			}
+		};
+
+		template<>
+		struct BatchCullSpheres<double> final
+		{
+			CIN_MATH_INLINE static std::size_t implementation(const std::array<Vector<4, double>, 6>& planes, const Vector<4, double>* CIN_MATH_RESTRICT spheres, std::uint8_t* CIN_MATH_RESTRICT visibility, const std::size_t count) noexcept
+			{
+				std::size_t visible{ 0U };
+				for (std::size_t i{ 0U }; i < count; ++i)
+				{
+					const Vector<4, double>& sphere{ spheres[i] };
+
+					bool inside{ true };
+					for (const Vector<4, double>& plane : planes)
+						inside &= (plane.x * sphere.x + plane.w + plane.y * sphere.y + plane.z * sphere.z + sphere.w) >= 0.0;
+
+					visibility[i] = static_cast<std::uint8_t>(inside);
+					visible += inside;
+				}
+
+				return visible;
+			}
+		};
+
+		template<typename ValueType, bool fast>
+		struct BatchNormalizeSoA final
+		{
+			CIN_MATH_INLINE static void implementation(ValueType* CIN_MATH_RESTRICT x, ValueType* CIN_MATH_RESTRICT y, ValueType* CIN_MATH_RESTRICT z, const std::size_t count) noexcept
+			{
+				for (std::size_t i{ 0U }; i < count; ++i)
+				{
+					const ValueType inverseLength{ static_cast<ValueType>(1) / std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]) };
+					x[i] *= inverseLength;
+					y[i] *= inverseLength;
+					z[i] *= inverseLength;
+				}
+			}
+		};
+
+		template<bool fast>
+		struct BatchNormalizeSoA<float, fast> final
+		{
+			CIN_MATH_INLINE static void implementation(float* CIN_MATH_RESTRICT x, float* CIN_MATH_RESTRICT y, float* CIN_MATH_RESTRICT z, const std::size_t count) noexcept
+			{
+				std::size_t i{ 0U };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+				for (; i + 8U <= count; i += 8U)
+				{
+					const __m256 vx{ _mm256_loadu_ps(x + i) };
+					const __m256 vy{ _mm256_loadu_ps(y + i) };
+					const __m256 vz{ _mm256_loadu_ps(z + i) };
+					const __m256 squaredLength{ _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)), _mm256_mul_ps(vz, vz)) };
+
+					__m256 inverseLength;
+					if constexpr (fast)
+						inverseLength = ReciprocalSqrt(squaredLength);
+					else
+						inverseLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(squaredLength));
+
+					_mm256_storeu_ps(x + i, _mm256_mul_ps(vx, inverseLength));
+					_mm256_storeu_ps(y + i, _mm256_mul_ps(vy, inverseLength));
+					_mm256_storeu_ps(z + i, _mm256_mul_ps(vz, inverseLength));
+				}
+#endif
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+				for (; i + 4U <= count; i += 4U)
+				{
+					const __m128 vx{ _mm_loadu_ps(x + i) };
+					const __m128 vy{ _mm_loadu_ps(y + i) };
+					const __m128 vz{ _mm_loadu_ps(z + i) };
+					const __m128 squaredLength{ _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)) };
+
+					__m128 inverseLength;
+					if constexpr (fast)
+						inverseLength = ReciprocalSqrt(squaredLength);
+					else
+						inverseLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(squaredLength));
+
+					_mm_storeu_ps(x + i, _mm_mul_ps(vx, inverseLength));
+					_mm_storeu_ps(y + i, _mm_mul_ps(vy, inverseLength));
+					_mm_storeu_ps(z + i, _mm_mul_ps(vz, inverseLength));
+				}
+#endif
+				/* Remainder */
+				for (; i < count; ++i)
+				{
+					const float inverseLength{ 1.0f / std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]) };
+					x[i] *= inverseLength;
+					y[i] *= inverseLength;
+					z[i] *= inverseLength;
+				}
+			}
+		};
+
+		/* output[i] = matrix * input[i], the sum of the matrix rows weighted by the vector components */
+		template<typename ValueType>
+		struct BatchTransformPoints final
+		{
+			CIN_MATH_INLINE static void implementation(const Matrix<4, 4, ValueType>& matrix, const Vector<4, ValueType>* CIN_MATH_RESTRICT input, Vector<4, ValueType>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+			{
+				/* Keeps the matrix in registers rather than reloading it through a possibly aliased reference */
+				const Matrix<4, 4, ValueType> transform{ matrix };
+				for (std::size_t i{ 0U }; i < count; ++i)
+					output[i] = transform * input[i];
+			}
+		};
+
+		/*
+		 * The rows are loaded (and broadcast to both AVX lanes) once for the whole array, every vector then costs four
+		 * component broadcasts and four multiply-adds, no horizontal adds. The AVX loop is TransformVector in both
+		 * lanes, so the results match the single vector operator bit for bit
+		 */
+		template<>
+		struct BatchTransformPoints<float> final
+		{
+			CIN_MATH_INLINE static void implementation(const Matrix<4, 4, float>& matrix, const Vector<4, float>* CIN_MATH_RESTRICT input, Vector<4, float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+			{
+				std::size_t i{ 0U };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+				const __m128 row0{ _mm_loadu_ps(matrix.raw) };
+				const __m128 row1{ _mm_loadu_ps(matrix.raw + 4) };
+				const __m128 row2{ _mm_loadu_ps(matrix.raw + 8) };
+				const __m128 row3{ _mm_loadu_ps(matrix.raw + 12) };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+				/* Two vectors per iteration, one in each lane */
+				const __m256 rows0{ _mm256_set_m128(row0, row0) };
+				const __m256 rows1{ _mm256_set_m128(row1, row1) };
+				const __m256 rows2{ _mm256_set_m128(row2, row2) };
+				const __m256 rows3{ _mm256_set_m128(row3, row3) };
+
+				for (; i + 2U <= count; i += 2U)
+				{
+					const __m256 vectors{ _mm256_loadu_ps(input[i].raw) };
+					__m256 result{ _mm256_mul_ps(_mm256_permute_ps(vectors, 0b00'00'00'00), rows0) };
+#if ((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX2_BIT)) && (defined(__FMA__) || defined(_MSC_VER))
+					result = _mm256_fmadd_ps(_mm256_permute_ps(vectors, 0b01'01'01'01), rows1, result);
+					result = _mm256_fmadd_ps(_mm256_permute_ps(vectors, 0b10'10'10'10), rows2, result);
+					result = _mm256_fmadd_ps(_mm256_permute_ps(vectors, 0b11'11'11'11), rows3, result);
+#else
+					result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_permute_ps(vectors, 0b01'01'01'01), rows1));
+					result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_permute_ps(vectors, 0b10'10'10'10), rows2));
+					result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_permute_ps(vectors, 0b11'11'11'11), rows3));
+#endif
+					_mm256_storeu_ps(output[i].raw, result);
+				}
+#endif
+				for (; i < count; ++i)
+					_mm_storeu_ps(output[i].raw, TransformVector(row0, row1, row2, row3, _mm_loadu_ps(input[i].raw)));
+#else
+				const Matrix<4, 4, float> transform{ matrix };
+				for (; i < count; ++i)
+					output[i] = transform * input[i];
+#endif
+			}
+		};
+
+		/* Element by element, the blocks from begin on (begin is a multiple of MatrixLaneWidth) */
+		template<typename ValueType>
+		CIN_MATH_INLINE void ToLanesScalar(const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, ValueType* CIN_MATH_RESTRICT lanes, const std::size_t begin, const std::size_t count) noexcept
+		{
+			for (std::size_t block{ begin / MatrixLaneWidth }; block * MatrixLaneWidth < count; ++block)
+			{
+				ValueType* const destination{ lanes + block * MatrixLaneWidth * 16U };
+				for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+				{
+					const std::size_t i{ block * MatrixLaneWidth + lane };
+					/* Padding lanes are identity matrices, ones on the diagonal (elements 0, 5, 10 and 15) */
+					for (std::size_t element{ 0U }; element < 16U; ++element)
+						destination[element * MatrixLaneWidth + lane] = i < count ? matrices[i].raw[element] : static_cast<ValueType>(element % 5U == 0U);
+				}
+			}
+		}
+
+		template<typename ValueType>
+		CIN_MATH_INLINE void FromLanesScalar(const ValueType* CIN_MATH_RESTRICT lanes, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, const std::size_t begin, const std::size_t count) noexcept
+		{
+			for (std::size_t i{ begin }; i < count; ++i)
+			{
+				const ValueType* const source{ lanes + i / MatrixLaneWidth * MatrixLaneWidth * 16U + i % MatrixLaneWidth };
+				for (std::size_t element{ 0U }; element < 16U; ++element)
+					matrices[i].raw[element] = source[element * MatrixLaneWidth];
+			}
+		}
+
+		template<typename ValueType>
+		struct BatchTransposeLanes final
+		{
+			CIN_MATH_INLINE static void ToLanes(const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, ValueType* CIN_MATH_RESTRICT lanes, const std::size_t count) noexcept
+			{
+				ToLanesScalar(matrices, lanes, 0U, count);
+			}
+
+			CIN_MATH_INLINE static void FromLanes(const ValueType* CIN_MATH_RESTRICT lanes, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, const std::size_t count) noexcept
+			{
+				FromLanesScalar(lanes, matrices, 0U, count);
+			}
+		};
+
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		/* In place transpose of 8 rows of 8 floats */
+		CIN_MATH_INLINE void CIN_MATH_CALL Transpose8x8(__m256 (&rows)[8]) noexcept
+		{
+			const __m256 e0{ _mm256_unpacklo_ps(rows[0], rows[1]) };
+			const __m256 e1{ _mm256_unpackhi_ps(rows[0], rows[1]) };
+			const __m256 e2{ _mm256_unpacklo_ps(rows[2], rows[3]) };
+			const __m256 e3{ _mm256_unpackhi_ps(rows[2], rows[3]) };
+			const __m256 e4{ _mm256_unpacklo_ps(rows[4], rows[5]) };
+			const __m256 e5{ _mm256_unpackhi_ps(rows[4], rows[5]) };
+			const __m256 e6{ _mm256_unpacklo_ps(rows[6], rows[7]) };
+			const __m256 e7{ _mm256_unpackhi_ps(rows[6], rows[7]) };
+
+			/* Columns 0-3 of rows 0-3 and 4-7 in the low and high lanes */
+			const __m256 f0{ _mm256_shuffle_ps(e0, e2, 0b01'00'01'00) };
+			const __m256 f1{ _mm256_shuffle_ps(e0, e2, 0b11'10'11'10) };
+			const __m256 f2{ _mm256_shuffle_ps(e1, e3, 0b01'00'01'00) };
+			const __m256 f3{ _mm256_shuffle_ps(e1, e3, 0b11'10'11'10) };
+			const __m256 f4{ _mm256_shuffle_ps(e4, e6, 0b01'00'01'00) };
+			const __m256 f5{ _mm256_shuffle_ps(e4, e6, 0b11'10'11'10) };
+			const __m256 f6{ _mm256_shuffle_ps(e5, e7, 0b01'00'01'00) };
+			const __m256 f7{ _mm256_shuffle_ps(e5, e7, 0b11'10'11'10) };
+
+			rows[0] = _mm256_permute2f128_ps(f0, f4, 0x20);
+			rows[1] = _mm256_permute2f128_ps(f1, f5, 0x20);
+			rows[2] = _mm256_permute2f128_ps(f2, f6, 0x20);
+			rows[3] = _mm256_permute2f128_ps(f3, f7, 0x20);
+			rows[4] = _mm256_permute2f128_ps(f0, f4, 0x31);
+			rows[5] = _mm256_permute2f128_ps(f1, f5, 0x31);
+			rows[6] = _mm256_permute2f128_ps(f2, f6, 0x31);
+			rows[7] = _mm256_permute2f128_ps(f3, f7, 0x31);
+		}
+#endif
+
+		/*
+		 * A block is a 8x16 transpose: eight matrices of sixteen elements become sixteen runs of eight lanes. AVX does
+		 * it as two 8x8 transposes (elements 0-7 and 8-15), SSE as eight 4x4 transposes, _MM_TRANSPOSE4_PS. The
+		 * conversion is its own inverse, FromLanes runs the same transposes with loads and stores swapped
+		 */
+		template<>
+		struct BatchTransposeLanes<float> final
+		{
+			CIN_MATH_INLINE static void ToLanes(const Matrix<4, 4, float>* CIN_MATH_RESTRICT matrices, float* CIN_MATH_RESTRICT lanes, const std::size_t count) noexcept
+			{
+				std::size_t i{ 0U };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+				for (; i + MatrixLaneWidth <= count; i += MatrixLaneWidth)
+				{
+					float* const block{ lanes + i * 16U };
+					for (std::size_t half{ 0U }; half < 2U; ++half)
+					{
+						__m256 rows[8];
+						for (std::size_t lane{ 0U }; lane < 8U; ++lane)
+							rows[lane] = _mm256_loadu_ps(matrices[i + lane].raw + half * 8U);
+
+						Transpose8x8(rows);
+						for (std::size_t element{ 0U }; element < 8U; ++element)
+							_mm256_storeu_ps(block + (half * 8U + element) * MatrixLaneWidth, rows[element]);
+					}
+				}
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+				for (; i + MatrixLaneWidth <= count; i += MatrixLaneWidth)
+				{
+					float* const block{ lanes + i * 16U };
+					for (std::size_t group{ 0U }; group < 2U; ++group)
+					{
+						const Matrix<4, 4, float>* const source{ matrices + i + group * 4U };
+						for (std::size_t row{ 0U }; row < 4U; ++row)
+						{
+							__m128 e0{ _mm_loadu_ps(source[0].raw + row * 4U) };
+							__m128 e1{ _mm_loadu_ps(source[1].raw + row * 4U) };
+							__m128 e2{ _mm_loadu_ps(source[2].raw + row * 4U) };
+							__m128 e3{ _mm_loadu_ps(source[3].raw + row * 4U) };
+							_MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+
+							float* const destination{ block + row * 4U * MatrixLaneWidth + group * 4U };
+							_mm_storeu_ps(destination, e0);
+							_mm_storeu_ps(destination + MatrixLaneWidth, e1);
+							_mm_storeu_ps(destination + 2U * MatrixLaneWidth, e2);
+							_mm_storeu_ps(destination + 3U * MatrixLaneWidth, e3);
+						}
+					}
+				}
+#endif
+				ToLanesScalar(matrices, lanes, i, count);
+			}
+
+			CIN_MATH_INLINE static void FromLanes(const float* CIN_MATH_RESTRICT lanes, Matrix<4, 4, float>* CIN_MATH_RESTRICT matrices, const std::size_t count) noexcept
+			{
+				std::size_t i{ 0U };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+				for (; i + MatrixLaneWidth <= count; i += MatrixLaneWidth)
+				{
+					const float* const block{ lanes + i * 16U };
+					for (std::size_t half{ 0U }; half < 2U; ++half)
+					{
+						__m256 rows[8];
+						for (std::size_t element{ 0U }; element < 8U; ++element)
+							rows[element] = _mm256_loadu_ps(block + (half * 8U + element) * MatrixLaneWidth);
+
+						Transpose8x8(rows);
+						for (std::size_t lane{ 0U }; lane < 8U; ++lane)
+							_mm256_storeu_ps(matrices[i + lane].raw + half * 8U, rows[lane]);
+					}
+				}
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+				for (; i + MatrixLaneWidth <= count; i += MatrixLaneWidth)
+				{
+					const float* const block{ lanes + i * 16U };
+					for (std::size_t group{ 0U }; group < 2U; ++group)
+					{
+						Matrix<4, 4, float>* const destination{ matrices + i + group * 4U };
+						for (std::size_t row{ 0U }; row < 4U; ++row)
+						{
+							const float* const source{ block + row * 4U * MatrixLaneWidth + group * 4U };
+							__m128 e0{ _mm_loadu_ps(source) };
+							__m128 e1{ _mm_loadu_ps(source + MatrixLaneWidth) };
+							__m128 e2{ _mm_loadu_ps(source + 2U * MatrixLaneWidth) };
+							__m128 e3{ _mm_loadu_ps(source + 3U * MatrixLaneWidth) };
+							_MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+
+							_mm_storeu_ps(destination[0].raw + row * 4U, e0);
+							_mm_storeu_ps(destination[1].raw + row * 4U, e1);
+							_mm_storeu_ps(destination[2].raw + row * 4U, e2);
+							_mm_storeu_ps(destination[3].raw + row * 4U, e3);
+						}
+					}
+				}
+#endif
+				FromLanesScalar(lanes, matrices, i, count);
+			}
+		};
+
+		template<typename ValueType>
+		struct BatchDecompose final
+		{
+			CIN_MATH_INLINE static void implementation(const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, Vector<3, ValueType>* CIN_MATH_RESTRICT translations, TQuaternion<ValueType>* CIN_MATH_RESTRICT rotations, Vector<3, ValueType>* CIN_MATH_RESTRICT scales, const std::size_t count) noexcept
+			{
+				for (std::size_t i{ 0U }; i < count; ++i)
+					Decompose(matrices[i], translations[i], rotations[i], scales[i]);
+			}
+		};
+
+		template<>
+		struct BatchDecompose<float> final
+		{
+			CIN_MATH_INLINE static void implementation(const Matrix<4, 4, float>* CIN_MATH_RESTRICT matrices, Vector<3, float>* CIN_MATH_RESTRICT translations, TQuaternion<float>* CIN_MATH_RESTRICT rotations, Vector<3, float>* CIN_MATH_RESTRICT scales, const std::size_t count) noexcept
+			{
+				/* One block of the lane layout, a partial last block is padded with identity matrices */
+				alignas(32) float lanes[16U * MatrixLaneWidth];
+				for (std::size_t i{ 0U }; i < count; i += MatrixLaneWidth)
+				{
+					const std::size_t width{ std::min(MatrixLaneWidth, count - i) };
+					BatchTransposeLanes<float>::ToLanes(matrices + i, lanes, width);
+
+					Vector3SoA translation;
+					QuaternionSoA rotation;
+					Vector3SoA scale;
+					Decompose(Matrix4SoA::Load(lanes), translation, rotation, scale);
+
+					for (std::size_t lane{ 0U }; lane < width; ++lane)
+					{
+						translations[i + lane] = translation.Get(lane);
+						rotations[i + lane] = rotation.Get(lane);
+						scales[i + lane] = scale.Get(lane);
+					}
+				}
+			}
+		};
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void MultiplyArray(const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT lhs, const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT rhs, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT result, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::MultiplyArray, count);
+		for (std::size_t i{ 0U }; i < count; ++i)
+			result[i] = lhs[i] * rhs[i];
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void MultiplyArray(const Matrix<4, 4, ValueType>& lhs, const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT rhs, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT result, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::MultiplyArray, count);
+		/* Keeps lhs in registers rather than reloading it through a possibly aliased reference */
+		const Matrix<4, 4, ValueType> matrix{ lhs };
+		for (std::size_t i{ 0U }; i < count; ++i)
+			result[i] = matrix * rhs[i];
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void TransformPoints(const Matrix<4, 4, ValueType>& matrix, const Vector<4, ValueType>* CIN_MATH_RESTRICT input, Vector<4, ValueType>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::TransformPoints, count);
+		Implementation::BatchTransformPoints<ValueType>::implementation(matrix, input, output, count);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void TransformPointsTransposed(const Matrix<4, 4, ValueType>& matrix, const Vector<4, ValueType>* CIN_MATH_RESTRICT input, Vector<4, ValueType>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::TransformPoints, count);
+		/* input[i] * matrix == Transpose(matrix) * input[i], transposed once for the whole array */
+		Implementation::BatchTransformPoints<ValueType>::implementation(Transpose(matrix), input, output, count);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void TransposeArray(const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, ValueType* CIN_MATH_RESTRICT lanes, const std::size_t count) noexcept
+	{
+		Implementation::BatchTransposeLanes<ValueType>::ToLanes(matrices, lanes, count);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void TransposeArray(const ValueType* CIN_MATH_RESTRICT lanes, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, const std::size_t count) noexcept
+	{
+		Implementation::BatchTransposeLanes<ValueType>::FromLanes(lanes, matrices, count);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void RotateArray(const TQuaternion<ValueType>& rotation, const Vector<3, ValueType>* CIN_MATH_RESTRICT input, Vector<3, ValueType>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::RotateArray, count);
+		const TQuaternion<ValueType> quaternion{ rotation };
+		for (std::size_t i{ 0U }; i < count; ++i)
+			output[i] = Rotate(input[i], quaternion);
+	}
+
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE void NormalizeArray(const Vector<length, ValueType>* input, Vector<length, ValueType>* output, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::NormalizeArray, count);
+		for (std::size_t i{ 0U }; i < count; ++i)
+			output[i] = Normalize(input[i]);
+	}
+
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE void NormalizeArrayFast(const Vector<length, ValueType>* input, Vector<length, ValueType>* output, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::NormalizeArray, count);
+		for (std::size_t i{ 0U }; i < count; ++i)
+			output[i] = NormalizeFast(input[i]);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void NormalizeArray(ValueType* CIN_MATH_RESTRICT x, ValueType* CIN_MATH_RESTRICT y, ValueType* CIN_MATH_RESTRICT z, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::NormalizeArray, count);
+		Implementation::BatchNormalizeSoA<ValueType, false>::implementation(x, y, z, count);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void NormalizeArrayFast(ValueType* CIN_MATH_RESTRICT x, ValueType* CIN_MATH_RESTRICT y, ValueType* CIN_MATH_RESTRICT z, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::NormalizeArray, count);
+		Implementation::BatchNormalizeSoA<ValueType, true>::implementation(x, y, z, count);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE std::size_t CullSpheres(const std::array<Vector<4, ValueType>, 6>& planes, const Vector<4, ValueType>* CIN_MATH_RESTRICT spheres, std::uint8_t* CIN_MATH_RESTRICT visibility, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::CullSpheres, count);
+		return Implementation::BatchCullSpheres<ValueType>::implementation(planes, spheres, visibility, count);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void DecomposeArray(const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT matrices, Vector<3, ValueType>* CIN_MATH_RESTRICT translations, TQuaternion<ValueType>* CIN_MATH_RESTRICT rotations, Vector<3, ValueType>* CIN_MATH_RESTRICT scales, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::DecomposeArray, count);
+		Implementation::BatchDecompose<ValueType>::implementation(matrices, translations, rotations, scales, count);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE Matrix<4, 4, ValueType> MultiplyChain(const Matrix<4, 4, ValueType>* matrices, const std::size_t count) noexcept
+	{
+		CIN_MATH_PROFILE_SCOPE(ProfileKernel::MultiplyChain, count);
+		if (count == 0U)
+			return Matrix<4, 4, ValueType>::Identity();
+
+		Matrix<4, 4, ValueType> result{ matrices[0] };
+		for (std::size_t i{ 1U }; i < count; ++i)
+			result *= matrices[i];
+
+		return result;
+	}
+}
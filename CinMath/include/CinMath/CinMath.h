@@ -99,6 +99,11 @@
 #include <xmmintrin.h>
 #endif
 
+/* FMA can be enabled below the AVX tiers (-msse2 -mfma), kernels that pin their FMA use need its intrinsics there too */
+#if defined(__FMA__) && ((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)) && !((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT))
+#include <immintrin.h>
+#endif
+
 #ifdef _MSC_VER
 #if (CIN_INSTRUCTION_SET != CIN_INSTRUCTION_SET_DEFAULT)
 #define CIN_MATH_CALL __vectorcall
@@ -147,6 +152,14 @@
 #include <stdint.h>
 #include <cstdint>
 #include <array>
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
 #include <sstream>
 #include <iostream>
 #include <assert.h>
@@ -223,10 +236,17 @@ namespace CinMath {
 		}
 	};
 
+	/*
+	 * The 2 and 3 element swizzles read and write element by element on every tier: Vector2 and Vector3 store plain
+	 * arrays, so a shuffle or blend would round trip through memory on the narrow side anyway, and the same views sit
+	 * in the Vector2 and Vector3 unions, where a 16 byte load or store would run past the object. Only Vector4Swizzle
+	 * reads and permutation writes are single shuffles
+	 */
 	template<typename Type, typename VectorType, std::size_t SwizzleFirst, std::size_t SwizzleSecond>
 	struct Vector2Swizzle final
 	{
-		Type View[2];
+		/* Sized to the highest component it reaches, zw views the last two elements of a Vector4 */
+		Type View[std::max({ SwizzleFirst, SwizzleSecond }) + 1U];
 
 		constexpr CIN_MATH_INLINE VectorType operator=(const Type scalar) const noexcept
 		{
@@ -292,7 +312,7 @@ namespace CinMath {
 	template<typename Type, typename VectorType, std::size_t SwizzleFirst, std::size_t SwizzleSecond, std::size_t SwizzleThird>
 	struct Vector3Swizzle final
 	{
-		Type View[3];
+		Type View[std::max({ SwizzleFirst, SwizzleSecond, SwizzleThird }) + 1U];
 
 		constexpr CIN_MATH_INLINE VectorType operator=(const Type scalar) noexcept
 		{
@@ -359,6 +379,11 @@ namespace CinMath {
 	struct Vector4Swizzle final
 	{
 		Type View[4];
+
+		/* Immediates for _mm_shuffle_ps/_mm_permute_ps, reading (and, for permutations, writing) the swizzle in one instruction */
+		static constexpr int ShuffleMask{ static_cast<int>(SwizzleFirst | SwizzleSecond << 2 | SwizzleThird << 4 | SwizzleFourth << 6) };
+		static constexpr bool IsPermutation{ ((1U << SwizzleFirst) | (1U << SwizzleSecond) | (1U << SwizzleThird) | (1U << SwizzleFourth)) == 0b1111U };
+		static constexpr int InverseShuffleMask{ static_cast<int>(0U << (2U * SwizzleFirst) | 1U << (2U * SwizzleSecond) | 2U << (2U * SwizzleThird) | 3U << (2U * SwizzleFourth)) };
 	
 		constexpr CIN_MATH_INLINE VectorType operator=(const Type scalar) const noexcept
 		{
@@ -397,6 +422,20 @@ namespace CinMath {
 		
 		constexpr CIN_MATH_INLINE VectorType operator=(const VectorType& vector) noexcept
 		{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+			if constexpr (std::is_same_v<Type, float> && IsPermutation)
+			{
+				if (!std::is_constant_evaluated())
+				{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+					_mm_store_ps(View, _mm_permute_ps(vector.data, InverseShuffleMask));
+#else
+					_mm_store_ps(View, _mm_shuffle_ps(vector.data, vector.data, InverseShuffleMask));
+#endif
+					return vector;
+				}
+			}
+#endif
 			return VectorType(View[SwizzleFirst] = vector.x, View[SwizzleSecond] = vector.y, View[SwizzleThird] = vector.z, View[SwizzleFourth] = vector.w);
 		}
 		
@@ -417,6 +456,23 @@ namespace CinMath {
 		
 		constexpr CIN_MATH_INLINE operator VectorType() const noexcept
 		{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+			if constexpr (std::is_same_v<Type, float>)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					/* The swizzle aliases the whole (aligned) __m128 of the vector */
+					VectorType result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+					result.data = _mm_permute_ps(_mm_load_ps(View), ShuffleMask);
+#else
+					const __m128 vector{ _mm_load_ps(View) };
+					result.data = _mm_shuffle_ps(vector, vector, ShuffleMask);
+#endif
+					return result;
+				}
+			}
+#endif
 			return VectorType(View[SwizzleFirst], View[SwizzleSecond], View[SwizzleThird], View[SwizzleFourth]);
 		}
 	};
@@ -442,6 +498,8 @@ namespace CinMath {
 	typedef float CinnamonFloat32Vector2_t[2];
 	typedef float CinnamonFloat32Vector3_t[3];
 	typedef float CinnamonFloat32Vector4_t[4];
+	typedef double CinnamonFloat64Vector2_t[2];
+	typedef double CinnamonFloat64Vector4_t[4];
 	/* Matrices */
 	typedef float CinnamonFloat32Matrix1x1_t;
 	typedef float CinnamonFloat32Matrix2x2_t[2 * 2];
@@ -459,6 +517,8 @@ namespace CinMath {
 	typedef float CinnamonFloat32Vector2_t[2];
 	typedef float CinnamonFloat32Vector3_t[3];
 	typedef __m128 CinnamonFloat32Vector4_t;
+	typedef __m128d CinnamonFloat64Vector2_t;
+	typedef __m256d CinnamonFloat64Vector4_t;
 	/* Matrices */
 	typedef float CinnamonFloat32Matrix1x1_t;
 	typedef __m128 CinnamonFloat32Matrix2x2_t;
@@ -476,6 +536,8 @@ namespace CinMath {
 	typedef float CinnamonFloat32Vector2_t[2];
 	typedef float CinnamonFloat32Vector3_t[3];
 	typedef __m128 CinnamonFloat32Vector4_t;
+	typedef __m128d CinnamonFloat64Vector2_t;
+	typedef double CinnamonFloat64Vector4_t[4];
 	/* Matrices */
 	typedef float CinnamonFloat32Matrix1x1_t;
 	typedef __m128 CinnamonFloat32Matrix2x2_t;
@@ -493,6 +555,8 @@ namespace CinMath {
 	typedef float CinnamonFloat32Vector2_t[2];
 	typedef float CinnamonFloat32Vector3_t[3];
 	typedef __m128 CinnamonFloat32Vector4_t;
+	typedef double CinnamonFloat64Vector2_t[2];
+	typedef double CinnamonFloat64Vector4_t[4];
 	/* Matrices */
 	typedef float CinnamonFloat32Matrix1x1_t;
 	typedef __m128  CinnamonFloat32Matrix2x2_t;
@@ -504,6 +568,21 @@ namespace CinMath {
 	typedef double CinnamonFloat64Matrix4x4_t[4 * 4];
 	/* Quaternions */
 	typedef CinnamonFloat32Vector4_t CinnamonFloat32Quaternion_t;
+#endif
+	/* Alignment of the widest register of the selected instruction set, used by the aligned containers */
+#if ((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX2_BIT)) || ((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT))
+	constexpr std::size_t SIMDAlignment{ 32U };
+#else
+	constexpr std::size_t SIMDAlignment{ 16U };
+#endif
+	static_assert((SIMDAlignment & (SIMDAlignment - 1U)) == 0U, "SIMD alignment must be a power of two");
+	static_assert(SIMDAlignment % alignof(CinnamonFloat32Vector4_t) == 0U, "Vector4 container is over-aligned for the selected instruction set");
+	static_assert(SIMDAlignment % alignof(CinnamonFloat32Matrix2x2_t) == 0U, "Matrix2x2 container is over-aligned for the selected instruction set");
+	static_assert(SIMDAlignment % alignof(CinnamonFloat32Matrix4x4_t) == 0U, "Matrix4x4 container is over-aligned for the selected instruction set");
+#if (CIN_INSTRUCTION_SET) != (CIN_INSTRUCTION_SET_DEFAULT_BIT)
+	static_assert(alignof(CinnamonFloat32Vector4_t) == 16U, "__m128 containers require 16 byte alignment");
+	static_assert(alignof(CinnamonFloat32Matrix4x4_t) == SIMDAlignment, "Matrix4x4 container must be aligned to the register width");
+	static_assert(SIMDAlignment % alignof(CinnamonFloat64Vector4_t) == 0U, "Vector4 double container is over-aligned for the selected instruction set");
 #endif
 	/* Linear vector containers */
 	template<Length_t length, typename ValueType>
@@ -535,6 +614,29 @@ namespace CinMath {
 		typedef CinnamonFloat32Vector4_t Container;
 	};
 
+	/* Vector 2, double precision */
+	template<>
+	struct Storage<2, double> final
+	{
+		typedef CinnamonFloat64Vector2_t Container;
+	};
+
+	/* Vector 4, double precision */
+	template<>
+	struct Storage<4, double> final
+	{
+		typedef CinnamonFloat64Vector4_t Container;
+	};
+
+	/* Half precision vectors, plain 16 bit lanes that the conversion instructions load directly */
+	struct Half;
+
+	template<Length_t length>
+	struct Storage<length, Half> final
+	{
+		typedef std::uint16_t Container[length];
+	};
+
 	/* Matrix containers */
 	template<Rows_t rows, Columns_t columns, typename ValueType>
 	struct MatrixStorage;
@@ -580,6 +682,13 @@ namespace CinMath {
 	{
 		typedef CinnamonFloat64Matrix4x4_t Container;
 	};
+
+	/* Matrix 4x4, half precision */
+	template<>
+	struct MatrixStorage<4, 4, Half> final
+	{
+		typedef std::uint16_t Container[4 * 4];
+	};
 }
 
 namespace CinMath {
@@ -603,8 +712,16 @@ namespace CinMath {
 
 #include "Angle.h"
 #include "Quaternion.h"
+#include "Half.h"
+#include "Quantization.h"
+#include "Format.h"
 
 #include "Transform.h"
+#include "Batch.h"
+#include "Matrix4SoA.h"
+
+#include "Memory.h"
+#include "Profile.h"
 
 /* Inline headers */
 #include "Vector2.inl"
@@ -619,6 +736,11 @@ namespace CinMath {
 #include "Quaternion.inl"
 
 #include "Transform.inl"
+#include "Batch.inl"
+#include "Matrix4SoA.inl"
+#include "Half.inl"
+#include "Quantization.inl"
+#include "Format.inl"
 
 #if _MSC_VER
 #pragma warning(pop)
@@ -746,16 +868,32 @@ namespace CinMath
 			}
 		};
 
+		/* Fixed notation with the 6 fraction digits of std::to_string: up to 309 whole digits for a double, sign and separator */
+		constexpr std::size_t MaxFixedNumberLength{ 320U };
+
+		/* Sizes of the number as std::to_string prints it with the trailing zeros removed, computed in a stack buffer */
 		template<typename ValueType>
-		FloatingPointNumberRepresantationSize FindMaxWholeAndFractionPartSizes(const ValueType* begin, const ValueType* end)
+		FloatingPointNumberRepresantationSize FindNumberSize(const ValueType value) noexcept
+		{
+			char buffer[MaxFixedNumberLength];
+			const std::to_chars_result result{ std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 6) };
+			std::string_view number{ buffer, static_cast<std::size_t>(result.ptr - buffer) };
+
+			/* SimplifyRealNumber without the string */
+			number = number.substr(0, number.find_last_not_of('0') + 1);
+			if (!number.empty() && number.back() == '.')
+				number.remove_suffix(1);
+
+			return FloatingPointNumberRepresantationSize::Calculate(number);
+		}
+
+		template<typename ValueType>
+		FloatingPointNumberRepresantationSize FindMaxWholeAndFractionPartSizes(const ValueType* begin, const ValueType* end) noexcept
 		{
 			FloatingPointNumberRepresantationSize max{ 0, 0 };
 			while(begin != end)
 			{
-				std::string number{ std::to_string(*begin) };
-				SimplifyRealNumber(number);
-
-				FloatingPointNumberRepresantationSize current{ FloatingPointNumberRepresantationSize::Calculate(number) };
+				const FloatingPointNumberRepresantationSize current{ FindNumberSize(*begin) };
 				if(current.WholeNumberPartLength > max.WholeNumberPartLength)
 					max.WholeNumberPartLength = current.WholeNumberPartLength;
 
@@ -767,6 +905,56 @@ namespace CinMath
 
 			return max;
 		}
+
+		inline void WritePadding(std::ostream& stream, std::size_t count)
+		{
+			static constexpr char spaces[32]{ ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ' };
+			for (; count > sizeof(spaces); count -= sizeof(spaces))
+				stream.write(spaces, sizeof(spaces));
+
+			stream.write(spaces, static_cast<std::streamsize>(count));
+		}
+
+		/**
+		 * Writes a matrix straight to the stream: every value is formatted with std::to_chars into a stack buffer and
+		 * right aligned in a column as wide as the widest value. Nothing is allocated and the format flags of the
+		 * stream are neither used nor changed
+		 */
+		template<typename PrintSpecifier, Rows_t rows, Columns_t columns, typename ValueType>
+		void WriteMatrix(std::ostream& stream, const Matrix<rows, columns, ValueType>& matrix)
+		{
+			const FloatingPointNumberRepresantationSize max{ FindMaxWholeAndFractionPartSizes(matrix.raw, matrix.raw + rows * columns) };
+			const std::size_t width{ (max.WholeNumberPartLength + 1) + (max.FractionNumberPartLength ? max.FractionNumberPartLength + 1 : 0) };
+			const int precision{ static_cast<int>(max.FractionNumberPartLength) };
+
+			stream.put('\n');
+			stream.put(PrintSpecifier::UpwardsColumnFacingLeft());
+			WritePadding(stream, width * columns + 1);
+			stream.put(PrintSpecifier::UpwardsColumnFacingRight());
+			stream.put('\n');
+
+			char buffer[MaxFixedNumberLength];
+			for (Rows_t row{ 0U }; row < rows; ++row)
+			{
+				stream.put(PrintSpecifier::Row());
+				for (Columns_t column{ 0U }; column < columns; ++column)
+				{
+					const std::to_chars_result result{ std::to_chars(buffer, buffer + sizeof(buffer), matrix.raw[row * columns + column], std::chars_format::fixed, precision) };
+					const std::size_t length{ static_cast<std::size_t>(result.ptr - buffer) };
+					WritePadding(stream, length < width ? width - length : 0U);
+					stream.write(buffer, static_cast<std::streamsize>(length));
+				}
+
+				stream.put(' ');
+				stream.put(PrintSpecifier::Row());
+				stream.put('\n');
+			}
+
+			stream.put(PrintSpecifier::DownwardsColumnFacingLeft());
+			WritePadding(stream, width * columns + 1);
+			stream.put(PrintSpecifier::DownwardsColumnFacingRight());
+			stream.put('\n');
+		}
 	}
 }
 
@@ -797,55 +985,22 @@ CIN_MATH_INLINE std::ostream& operator<<(std::ostream& stream, const CinMath::Pr
 template<typename ValueType, typename PrintSpecifier = CinMath::Printing::DefaultMatrixPrintSpecificer>
 CIN_MATH_INLINE std::ostream& operator<<(std::ostream& stream, const CinMath::Printing::MatrixPrinter<CinMath::Matrix<2, 2, ValueType>, PrintSpecifier>& printer) noexcept
 {
-	const CinMath::Matrix<2, 2, ValueType>& matrix{ printer.Reference };
-	const auto max{ CinMath::Printing::FindMaxWholeAndFractionPartSizes(&matrix.m11, &matrix.m22) };
-	const size_t width{ (max.WholeNumberPartLength + 1) + (max.FractionNumberPartLength ? max.FractionNumberPartLength + 1 : 0) };
-
-	std::stringstream output;
-	output << '\n' << std::fixed << std::setprecision(max.FractionNumberPartLength) 
-		<< PrintSpecifier::UpwardsColumnFacingLeft() << std::setw(width * 2 + 1) << ' ' << PrintSpecifier::UpwardsColumnFacingRight() 	   << '\n'
-		<< PrintSpecifier::Row() << std::setw(width) << matrix[0]  << std::setw(width) << matrix[1] << ' ' << PrintSpecifier::Row() 	   << '\n'
-		<< PrintSpecifier::Row() << std::setw(width) << matrix[2]  << std::setw(width) << matrix[3] << ' ' << PrintSpecifier::Row() 	   << '\n'
-		<< PrintSpecifier::DownwardsColumnFacingLeft() << std::setw(width * 2 + 1) << ' ' << PrintSpecifier::DownwardsColumnFacingRight()  << '\n';
-
-	return stream << output.str();
+	CinMath::Printing::WriteMatrix<PrintSpecifier>(stream, printer.Reference);
+	return stream;
 }
 
 template<typename ValueType, typename PrintSpecifier = CinMath::Printing::DefaultMatrixPrintSpecificer>
 CIN_MATH_INLINE std::ostream& operator<<(std::ostream& stream, const CinMath::Printing::MatrixPrinter<CinMath::Matrix<3, 3, ValueType>, PrintSpecifier>& printer) noexcept
 {
-	const CinMath::Matrix<3, 3, ValueType>& matrix{ printer.Reference };
-	const auto max{ CinMath::Printing::FindMaxWholeAndFractionPartSizes(&matrix.m11, &matrix.m33) };
-	const size_t width{ (max.WholeNumberPartLength + 1) + (max.FractionNumberPartLength ? max.FractionNumberPartLength + 1 : 0) };
-
-	std::stringstream output;
-	output << '\n' << std::fixed << std::setprecision(max.FractionNumberPartLength) 
-		<< PrintSpecifier::UpwardsColumnFacingLeft() << std::setw(width * 3 + 1) << ' ' << PrintSpecifier::UpwardsColumnFacingRight() << '\n'
-		<< PrintSpecifier::Row() << std::setw(width) << matrix[0]  << std::setw(width) << matrix[1]  << std::setw(width) << matrix[2] << ' ' << PrintSpecifier::Row() << '\n'
-		<< PrintSpecifier::Row() << std::setw(width) << matrix[3]  << std::setw(width) << matrix[4]  << std::setw(width) << matrix[5] << ' ' << PrintSpecifier::Row() << '\n'
-		<< PrintSpecifier::Row() << std::setw(width) << matrix[6]  << std::setw(width) << matrix[7]  << std::setw(width) << matrix[8] << ' ' << PrintSpecifier::Row() << '\n'
-		<< PrintSpecifier::DownwardsColumnFacingLeft() << std::setw(width * 3 + 1) << ' ' << PrintSpecifier::DownwardsColumnFacingRight() << '\n';
-
-	return stream << output.str();
+	CinMath::Printing::WriteMatrix<PrintSpecifier>(stream, printer.Reference);
+	return stream;
 }
 
 template<typename ValueType, typename PrintSpecifier = CinMath::Printing::DefaultMatrixPrintSpecificer>
 CIN_MATH_INLINE std::ostream& operator<<(std::ostream& stream, const CinMath::Printing::MatrixPrinter<CinMath::Matrix<4, 4, ValueType>, PrintSpecifier>& printer) noexcept
 {
-	const CinMath::Matrix<4, 4, ValueType>& matrix{ printer.Reference };
-	const auto max{ CinMath::Printing::FindMaxWholeAndFractionPartSizes(&matrix.m11, &matrix.m44) };
-	const size_t width{ (max.WholeNumberPartLength + 1) + (max.FractionNumberPartLength ? max.FractionNumberPartLength + 1 : 0) };
-
-	std::stringstream output;
-	output << '\n' << std::fixed << std::setprecision(max.FractionNumberPartLength) 
-		<< PrintSpecifier::UpwardsColumnFacingLeft() << std::setw(width * 4 + 1) << ' ' << PrintSpecifier::UpwardsColumnFacingRight() << '\n'
-		<< PrintSpecifier::Row() << std::setw(width) << matrix[0]  << std::setw(width) << matrix[1]  << std::setw(width) << matrix[2]  << std::setw(width) << matrix[3]  << ' ' << PrintSpecifier::Row() << '\n'
-		<< PrintSpecifier::Row() << std::setw(width) << matrix[4]  << std::setw(width) << matrix[5]  << std::setw(width) << matrix[6]  << std::setw(width) << matrix[7]  << ' ' << PrintSpecifier::Row() << '\n'
-		<< PrintSpecifier::Row() << std::setw(width) << matrix[8]  << std::setw(width) << matrix[9]  << std::setw(width) << matrix[10] << std::setw(width) << matrix[11] << ' ' << PrintSpecifier::Row() << '\n'
-		<< PrintSpecifier::Row() << std::setw(width) << matrix[12] << std::setw(width) << matrix[13] << std::setw(width) << matrix[14] << std::setw(width) << matrix[15] << ' ' << PrintSpecifier::Row() << '\n'
-		<< PrintSpecifier::DownwardsColumnFacingLeft() << std::setw(width * 4 + 1) << ' ' << PrintSpecifier::DownwardsColumnFacingRight() << '\n';
-
-	return stream << output.str();
+	CinMath::Printing::WriteMatrix<PrintSpecifier>(stream, printer.Reference);
+	return stream;
 }
 
 template<CinMath::Length_t length, typename ValueType>
@@ -0,0 +1,107 @@
+#pragma once
+/* Opt-in: batch operations driven by standard execution policies (std::execution::seq, par, par_unseq, unseq).
+ * The standard library backend (TBB, OpenMP, ...) does the scheduling. With libstdc++ the parallel policies
+ * need TBB at link time */
+#include "CinMath.h"
+
+#include <algorithm>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace CinMath {
+	template<typename ExecutionPolicy>
+	concept ExecutionPolicyType = std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>;
+
+	/**
+	 * Transforms points by a matrix, output[i] = matrix * input[i]
+	 *
+	 * @param input execution policy
+	 * @param input transformation matrix
+	 * @param input points
+	 * @param output transformed points
+	 * @param input number of points
+	 */
+	template<ExecutionPolicyType ExecutionPolicy, typename ValueType>
+	void TransformPoints(ExecutionPolicy&& policy, const Matrix<4, 4, ValueType>& matrix, const Vector<4, ValueType>* input, Vector<4, ValueType>* output, const std::size_t count)
+	{
+		std::transform(std::forward<ExecutionPolicy>(policy), input, input + count, output, [matrix](const Vector<4, ValueType>& point) noexcept
+		{
+			return matrix * point;
+		});
+	}
+
+	/**
+	 * Normalizes vectors, output[i] = Normalize(input[i])
+	 *
+	 * @param input execution policy
+	 * @param input vectors
+	 * @param output normalized vectors, may be the input
+	 * @param input number of vectors
+	 */
+	template<ExecutionPolicyType ExecutionPolicy, Length_t length, typename ValueType>
+	void NormalizeArray(ExecutionPolicy&& policy, const Vector<length, ValueType>* input, Vector<length, ValueType>* output, const std::size_t count)
+	{
+		std::transform(std::forward<ExecutionPolicy>(policy), input, input + count, output, [](const Vector<length, ValueType>& vector) noexcept
+		{
+			return Normalize(vector);
+		});
+	}
+
+	/**
+	 * Sums the dot products of vector pairs, dot(lhs[0], rhs[0]) + ... + dot(lhs[count - 1], rhs[count - 1])
+	 *
+	 * @param input execution policy
+	 * @param input left hand side vectors
+	 * @param input right hand side vectors
+	 * @param input number of vector pairs
+	 * @return sum of the dot products, summation order depends on the policy
+	 */
+	template<ExecutionPolicyType ExecutionPolicy, Length_t length, typename ValueType>
+	ValueType DotReduce(ExecutionPolicy&& policy, const Vector<length, ValueType>* lhs, const Vector<length, ValueType>* rhs, const std::size_t count)
+	{
+		return std::transform_reduce(std::forward<ExecutionPolicy>(policy), lhs, lhs + count, rhs, static_cast<ValueType>(0), std::plus<ValueType>{},
+			[](const Vector<length, ValueType>& lhs, const Vector<length, ValueType>& rhs) noexcept
+		{
+			return Dot(lhs, rhs);
+		});
+	}
+
+	/**
+	 * Multiplies a chain of matrices in order, matrices[0] * ... * matrices[count - 1]. The product is not
+	 * commutative so std::reduce cannot be used: contiguous blocks are multiplied under the policy and the
+	 * block products are then folded left to right
+	 *
+	 * @param input execution policy
+	 * @param input matrices
+	 * @param input number of matrices
+	 * @return product of the chain, identity for an empty chain
+	 */
+	template<ExecutionPolicyType ExecutionPolicy, typename ValueType>
+	Matrix<4, 4, ValueType> MultiplyChain(ExecutionPolicy&& policy, const Matrix<4, 4, ValueType>* matrices, const std::size_t count)
+	{
+		/* Below this a block costs less than scheduling it */
+		constexpr std::size_t minimumBlockSize{ 64U };
+		const std::size_t maximumBlocks{ std::max<std::size_t>(std::thread::hardware_concurrency(), 1U) * 4U };
+		const std::size_t blockCount{ std::clamp<std::size_t>(count / minimumBlockSize, 1U, maximumBlocks) };
+		if (blockCount == 1U)
+			return MultiplyChain(matrices, count);
+
+		const std::size_t blockSize{ (count + blockCount - 1U) / blockCount };
+		Array<Matrix<4, 4, ValueType>> partial(blockCount, Matrix<4, 4, ValueType>::Identity());
+		Matrix<4, 4, ValueType>* const partialBegin{ partial.data() };
+
+		std::for_each(std::forward<ExecutionPolicy>(policy), partial.begin(), partial.end(), [=](Matrix<4, 4, ValueType>& product) noexcept
+		{
+			const std::size_t begin{ static_cast<std::size_t>(&product - partialBegin) * blockSize };
+			const std::size_t end{ std::min(begin + blockSize, count) };
+			if (begin < end)
+				product = MultiplyChain(matrices + begin, end - begin);
+		});
+
+		return MultiplyChain(partial.data(), partial.size());
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+namespace CinMath {
+	/**
+	 * Text form of vectors, matrices and quaternions for logs and telemetry. Values are written with std::to_chars
+	 * in their shortest form that reads back to the same bits, so Parse(Format(x)) == x. Vectors and quaternions are
+	 * written as [x, y, z], matrices as one bracketed list per row, [[m11, m12], [m21, m22]]. Non-finite values are
+	 * written as inf, -inf and nan so they read back too, which makes that text JSON only when every value is finite.
+	 * Nothing is allocated: the caller provides the buffer and, like std::to_chars, gets back the end of the output
+	 * or std::errc::value_too_large when the buffer is too small (its contents are then unspecified)
+	 */
+	enum class TextFormat : std::uint32_t
+	{
+		/* One element per line, components separated by commas, matrices flattened row by row */
+		Csv = 0U,
+		/* A JSON array of elements, one element per line, non-finite values written as null (not read back by Parse) */
+		Json = 1U
+	};
+
+	/* Upper bound of the characters Format writes for one value, "-1.17549435e-38" and "-2.2250738585072014e-308" */
+	template<typename ValueType>
+	constexpr std::size_t MaxFormattedValueLength{ std::is_same_v<ValueType, float> ? 15U : 24U };
+
+	/**
+	 * Upper bound of the characters FormatArray writes
+	 *
+	 * @param input number of values in one element
+	 * @param input number of elements
+	 * @param input text format
+	 * @return size of a buffer that always fits the output
+	 */
+	template<typename ValueType>
+	constexpr std::size_t MaxFormattedArrayLength(const std::size_t valuesPerElement, const std::size_t count, const TextFormat format) noexcept
+	{
+		/* Per value its separator ", " (CSV: ","), per element its line break and at most 2 + 2 * 4 brackets (JSON) */
+		const std::size_t element{ valuesPerElement * (MaxFormattedValueLength<ValueType> + 2U) + (format == TextFormat::Json ? 12U : 1U) };
+		return count * element + (format == TextFormat::Json ? 4U : 0U);
+	}
+
+	/**
+	 * Writes a vector as [x, y, ...]
+	 *
+	 * @param output first character of the buffer
+	 * @param input one past the last character of the buffer
+	 * @param input vector
+	 * @return end of the output, or last and std::errc::value_too_large
+	 */
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE std::to_chars_result Format(char* first, char* last, const Vector<length, ValueType>& vector) noexcept;
+
+	/**
+	 * Writes a matrix as [[row 1], [row 2], ...]
+	 *
+	 * @param output first character of the buffer
+	 * @param input one past the last character of the buffer
+	 * @param input matrix
+	 * @return end of the output, or last and std::errc::value_too_large
+	 */
+	template<Rows_t rows, Columns_t columns, typename ValueType>
+	CIN_MATH_INLINE std::to_chars_result Format(char* first, char* last, const Matrix<rows, columns, ValueType>& matrix) noexcept;
+
+	/**
+	 * Writes a quaternion as [a, b, c, d]
+	 *
+	 * @param output first character of the buffer
+	 * @param input one past the last character of the buffer
+	 * @param input quaternion
+	 * @return end of the output, or last and std::errc::value_too_large
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE std::to_chars_result Format(char* first, char* last, const TQuaternion<ValueType>& quaternion) noexcept;
+
+	/**
+	 * Reads a vector written by Format, whitespace between the tokens is skipped
+	 *
+	 * @param input first character of the text
+	 * @param input one past the last character of the text
+	 * @param output vector, unspecified on failure
+	 * @return one past the parsed text, or the position of the error and std::errc::invalid_argument
+	 *		   (std::errc::result_out_of_range when a value does not fit the value type)
+	 */
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE std::from_chars_result Parse(const char* first, const char* last, Vector<length, ValueType>& vector) noexcept;
+
+	/**
+	 * Reads a matrix written by Format, whitespace between the tokens is skipped
+	 *
+	 * @param input first character of the text
+	 * @param input one past the last character of the text
+	 * @param output matrix, unspecified on failure
+	 * @return one past the parsed text, or the position of the error and std::errc::invalid_argument
+	 *		   (std::errc::result_out_of_range when a value does not fit the value type)
+	 */
+	template<Rows_t rows, Columns_t columns, typename ValueType>
+	CIN_MATH_INLINE std::from_chars_result Parse(const char* first, const char* last, Matrix<rows, columns, ValueType>& matrix) noexcept;
+
+	/**
+	 * Reads a quaternion written by Format, whitespace between the tokens is skipped
+	 *
+	 * @param input first character of the text
+	 * @param input one past the last character of the text
+	 * @param output quaternion, unspecified on failure
+	 * @return one past the parsed text, or the position of the error and std::errc::invalid_argument
+	 *		   (std::errc::result_out_of_range when a value does not fit the value type)
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE std::from_chars_result Parse(const char* first, const char* last, TQuaternion<ValueType>& quaternion) noexcept;
+
+	/**
+	 * Writes an array of vectors, matrices or quaternions as one CSV block or one JSON array. CSV blocks of
+	 * consecutive calls concatenate, so large arrays can be streamed through a fixed buffer in chunks
+	 *
+	 * @param output first character of the buffer, MaxFormattedArrayLength characters always suffice
+	 * @param input one past the last character of the buffer
+	 * @param input elements
+	 * @param input number of elements
+	 * @param input text format
+	 * @return end of the output, or last and std::errc::value_too_large
+	 */
+	template<typename ElementType>
+	CIN_MATH_INLINE std::to_chars_result FormatArray(char* first, char* last, const ElementType* elements, const std::size_t count, const TextFormat format) noexcept;
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+namespace CinMath {
+	namespace Implementation {
+		CIN_MATH_INLINE std::to_chars_result FormatCharacters(char* const first, char* const last, const std::string_view characters) noexcept
+		{
+			if (static_cast<std::size_t>(last - first) < characters.size())
+				return { last, std::errc::value_too_large };
+
+			std::memcpy(first, characters.data(), characters.size());
+			return { first + characters.size(), std::errc{} };
+		}
+
+		/*
+		 * Writes values separated by the separator, with the opening and closing characters around them when given.
+		 * JSON has no inf or nan, json writes non-finite values as null
+		 */
+		template<typename ValueType>
+		CIN_MATH_INLINE std::to_chars_result FormatValues(char* first, char* const last, const ValueType* const values, const std::size_t count, const std::string_view separator, const std::string_view opening, const std::string_view closing, const bool json) noexcept
+		{
+			std::to_chars_result result{ FormatCharacters(first, last, opening) };
+			for (std::size_t i{ 0U }; i < count && result.ec == std::errc{}; ++i)
+			{
+				if (i != 0U)
+					result = FormatCharacters(result.ptr, last, separator);
+
+				if (result.ec == std::errc{})
+					result = json && !std::isfinite(values[i]) ? FormatCharacters(result.ptr, last, "null") : std::to_chars(result.ptr, last, values[i]);
+			}
+
+			return result.ec == std::errc{} ? FormatCharacters(result.ptr, last, closing) : result;
+		}
+
+		template<Rows_t rows, Columns_t columns, typename ValueType>
+		CIN_MATH_INLINE std::to_chars_result FormatRows(char* first, char* const last, const Matrix<rows, columns, ValueType>& matrix, const std::string_view separator, const bool brackets, const bool json) noexcept
+		{
+			std::to_chars_result result{ FormatCharacters(first, last, brackets ? "[" : "") };
+			for (Rows_t row{ 0U }; row < rows && result.ec == std::errc{}; ++row)
+			{
+				if (row != 0U)
+					result = FormatCharacters(result.ptr, last, separator);
+
+				if (result.ec == std::errc{})
+					result = FormatValues(result.ptr, last, matrix.raw + row * columns, columns, separator, brackets ? "[" : "", brackets ? "]" : "", json);
+			}
+
+			return result.ec == std::errc{} ? FormatCharacters(result.ptr, last, brackets ? "]" : "") : result;
+		}
+
+		/* CSV rows are the plain values, matrices flattened row by row */
+		template<Length_t length, typename ValueType>
+		CIN_MATH_INLINE std::to_chars_result FormatCsv(char* first, char* last, const Vector<length, ValueType>& vector) noexcept
+		{
+			return FormatValues(first, last, vector.raw, length, ",", "", "", false);
+		}
+
+		template<Rows_t rows, Columns_t columns, typename ValueType>
+		CIN_MATH_INLINE std::to_chars_result FormatCsv(char* first, char* last, const Matrix<rows, columns, ValueType>& matrix) noexcept
+		{
+			return FormatRows(first, last, matrix, ",", false, false);
+		}
+
+		template<typename ValueType>
+		CIN_MATH_INLINE std::to_chars_result FormatCsv(char* first, char* last, const TQuaternion<ValueType>& quaternion) noexcept
+		{
+			return FormatValues(first, last, quaternion.raw, 4U, ",", "", "", false);
+		}
+
+		/* JSON elements are the bracketed Format output with non-finite values as null */
+		template<Length_t length, typename ValueType>
+		CIN_MATH_INLINE std::to_chars_result FormatJson(char* first, char* last, const Vector<length, ValueType>& vector) noexcept
+		{
+			return FormatValues(first, last, vector.raw, length, ", ", "[", "]", true);
+		}
+
+		template<Rows_t rows, Columns_t columns, typename ValueType>
+		CIN_MATH_INLINE std::to_chars_result FormatJson(char* first, char* last, const Matrix<rows, columns, ValueType>& matrix) noexcept
+		{
+			return FormatRows(first, last, matrix, ", ", true, true);
+		}
+
+		template<typename ValueType>
+		CIN_MATH_INLINE std::to_chars_result FormatJson(char* first, char* last, const TQuaternion<ValueType>& quaternion) noexcept
+		{
+			return FormatValues(first, last, quaternion.raw, 4U, ", ", "[", "]", true);
+		}
+
+		CIN_MATH_INLINE const char* SkipWhitespace(const char* first, const char* const last) noexcept
+		{
+			while (first != last && (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\r'))
+				++first;
+
+			return first;
+		}
+
+		CIN_MATH_INLINE std::from_chars_result ParseCharacter(const char* first, const char* const last, const char character) noexcept
+		{
+			first = SkipWhitespace(first, last);
+			if (first == last || *first != character)
+				return { first, std::errc::invalid_argument };
+
+			return { first + 1, std::errc{} };
+		}
+
+		/* Reads [v, v, ...] with exactly count values */
+		template<typename ValueType>
+		CIN_MATH_INLINE std::from_chars_result ParseValues(const char* const first, const char* const last, ValueType* const values, const std::size_t count) noexcept
+		{
+			std::from_chars_result result{ ParseCharacter(first, last, '[') };
+			for (std::size_t i{ 0U }; i < count && result.ec == std::errc{}; ++i)
+			{
+				if (i != 0U)
+					result = ParseCharacter(result.ptr, last, ',');
+
+				if (result.ec == std::errc{})
+					result = std::from_chars(SkipWhitespace(result.ptr, last), last, values[i]);
+			}
+
+			return result.ec == std::errc{} ? ParseCharacter(result.ptr, last, ']') : result;
+		}
+	}
+
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE std::to_chars_result Format(char* first, char* last, const Vector<length, ValueType>& vector) noexcept
+	{
+		return Implementation::FormatValues(first, last, vector.raw, length, ", ", "[", "]", false);
+	}
+
+	template<Rows_t rows, Columns_t columns, typename ValueType>
+	CIN_MATH_INLINE std::to_chars_result Format(char* first, char* last, const Matrix<rows, columns, ValueType>& matrix) noexcept
+	{
+		return Implementation::FormatRows(first, last, matrix, ", ", true, false);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE std::to_chars_result Format(char* first, char* last, const TQuaternion<ValueType>& quaternion) noexcept
+	{
+		return Implementation::FormatValues(first, last, quaternion.raw, 4U, ", ", "[", "]", false);
+	}
+
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE std::from_chars_result Parse(const char* first, const char* last, Vector<length, ValueType>& vector) noexcept
+	{
+		return Implementation::ParseValues(first, last, vector.raw, length);
+	}
+
+	template<Rows_t rows, Columns_t columns, typename ValueType>
+	CIN_MATH_INLINE std::from_chars_result Parse(const char* first, const char* last, Matrix<rows, columns, ValueType>& matrix) noexcept
+	{
+		std::from_chars_result result{ Implementation::ParseCharacter(first, last, '[') };
+		for (Rows_t row{ 0U }; row < rows && result.ec == std::errc{}; ++row)
+		{
+			if (row != 0U)
+				result = Implementation::ParseCharacter(result.ptr, last, ',');
+
+			if (result.ec == std::errc{})
+				result = Implementation::ParseValues(result.ptr, last, matrix.raw + row * columns, columns);
+		}
+
+		return result.ec == std::errc{} ? Implementation::ParseCharacter(result.ptr, last, ']') : result;
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE std::from_chars_result Parse(const char* first, const char* last, TQuaternion<ValueType>& quaternion) noexcept
+	{
+		return Implementation::ParseValues(first, last, quaternion.raw, 4U);
+	}
+
+	template<typename ElementType>
+	CIN_MATH_INLINE std::to_chars_result FormatArray(char* first, char* last, const ElementType* elements, const std::size_t count, const TextFormat format) noexcept
+	{
+		const bool json{ format == TextFormat::Json };
+		std::to_chars_result result{ Implementation::FormatCharacters(first, last, json ? "[\n" : "") };
+		for (std::size_t i{ 0U }; i < count && result.ec == std::errc{}; ++i)
+		{
+			if (json)
+			{
+				result = Implementation::FormatJson(result.ptr, last, elements[i]);
+				if (result.ec == std::errc{})
+					result = Implementation::FormatCharacters(result.ptr, last, i + 1U != count ? ",\n" : "\n");
+			}
+			else
+			{
+				result = Implementation::FormatCsv(result.ptr, last, elements[i]);
+
+				if (result.ec == std::errc{})
+					result = Implementation::FormatCharacters(result.ptr, last, "\n");
+			}
+		}
+
+		return result.ec == std::errc{} ? Implementation::FormatCharacters(result.ptr, last, json ? "]\n" : "") : result;
+	}
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+/* F16C is its own CPUID bit: every AVX2 processor has it, not every AVX one. GCC and Clang announce it with -mf16c */
+#if ((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)) && (defined(__F16C__) || (defined(_MSC_VER) && ((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX2_BIT))))
+#define CIN_MATH_USE_F16C
+#endif
+
+namespace CinMath {
+	namespace Implementation {
+		/* Round to nearest, ties to even. Overflow gives infinity, NaN stays quiet NaN with its top payload bits */
+		constexpr std::uint16_t FloatToHalfBits(const float value) noexcept
+		{
+			const std::uint32_t bits{ std::bit_cast<std::uint32_t>(value) };
+			const std::uint32_t sign{ (bits >> 16U) & 0x8000U };
+			const std::uint32_t absolute{ bits & 0x7FFF'FFFFU };
+
+			/* Infinity and NaN */
+			if (absolute >= 0x7F80'0000U)
+				return static_cast<std::uint16_t>(sign | 0x7C00U | (absolute > 0x7F80'0000U ? 0x0200U | ((absolute >> 13U) & 0x03FFU) : 0U));
+
+			/* 65536 and above, everything from 65520 rounds up to it below */
+			if (absolute >= 0x4780'0000U)
+				return static_cast<std::uint16_t>(sign | 0x7C00U);
+
+			std::uint32_t result;
+			std::uint32_t remainder;
+			std::uint32_t halfway;
+			if (absolute < 0x3880'0000U)
+			{
+				/* Half subnormals, 2^-25 and below round to zero */
+				if (absolute <= 0x3300'0000U)
+					return static_cast<std::uint16_t>(sign);
+
+				const std::uint32_t shift{ 126U - (absolute >> 23U) };
+				const std::uint32_t mantissa{ (absolute & 0x007F'FFFFU) | 0x0080'0000U };
+				result = mantissa >> shift;
+				remainder = mantissa & ((1U << shift) - 1U);
+				halfway = 1U << (shift - 1U);
+			}
+			else
+			{
+				/* Rebias the exponent from 127 to 15, a mantissa carry correctly bumps the exponent */
+				result = (absolute - 0x3800'0000U) >> 13U;
+				remainder = absolute & 0x1FFFU;
+				halfway = 0x1000U;
+			}
+
+			if (remainder > halfway || (remainder == halfway && (result & 1U)))
+				++result;
+
+			return static_cast<std::uint16_t>(sign | result);
+		}
+
+		constexpr float HalfBitsToFloat(const std::uint16_t bits) noexcept
+		{
+			const std::uint32_t sign{ (static_cast<std::uint32_t>(bits) & 0x8000U) << 16U };
+			const std::uint32_t exponent{ (static_cast<std::uint32_t>(bits) >> 10U) & 0x1FU };
+			const std::uint32_t mantissa{ static_cast<std::uint32_t>(bits) & 0x03FFU };
+
+			if (exponent == 0x1FU)
+				return std::bit_cast<float>(sign | 0x7F80'0000U | (mantissa << 13U));
+
+			if (exponent == 0U)
+			{
+				/* Zero and subnormals, mantissa * 2^-24 is exact in float */
+				const float magnitude{ static_cast<float>(mantissa) * 0x1p-24f };
+				return sign ? -magnitude : magnitude;
+			}
+
+			return std::bit_cast<float>(sign | ((exponent + 112U) << 23U) | (mantissa << 13U));
+		}
+	}
+
+	/**
+	 * IEEE 754 binary16 storage type. There is no arithmetic, values are meant to be stored in half and converted
+	 * to float (in bulk, see ConvertArray) before any math. Conversion from float rounds to nearest, ties to even
+	 */
+	struct Half final
+	{
+		constexpr Half() noexcept = default;
+
+		constexpr explicit Half(const float value) noexcept
+			:
+			Bits(Implementation::FloatToHalfBits(value))
+		{}
+
+		static constexpr Half FromBits(const std::uint16_t bits) noexcept
+		{
+			Half half;
+			half.Bits = bits;
+			return half;
+		}
+
+		constexpr explicit operator float() const noexcept
+		{
+			return Implementation::HalfBitsToFloat(Bits);
+		}
+
+		/* Numeric comparison: +0 equals -0, NaN equals nothing */
+		constexpr bool operator==(const Half other) const noexcept
+		{
+			return static_cast<float>(*this) == static_cast<float>(other);
+		}
+
+		constexpr bool operator!=(const Half other) const noexcept
+		{
+			return !(*this == other);
+		}
+
+		std::uint16_t Bits;
+	};
+
+	static_assert(sizeof(Half) == 2U && std::is_trivially_copyable_v<Half>, "Half must stay a plain 16 bit value");
+
+	typedef Matrix<4, 4, Half> Matrix4h;
+
+	/**
+	 * Converts floats to half precision
+	 *
+	 * @param input floats
+	 * @param output halves, must not alias the input
+	 * @param input number of values
+	 */
+	CIN_MATH_INLINE void ConvertArray(const float* CIN_MATH_RESTRICT input, Half* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Converts half precision values to floats
+	 *
+	 * @param input halves
+	 * @param output floats, must not alias the input
+	 * @param input number of values
+	 */
+	CIN_MATH_INLINE void ConvertArray(const Half* CIN_MATH_RESTRICT input, float* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Converts float vectors to half precision vectors
+	 *
+	 * @param input vectors
+	 * @param output half precision vectors, must not alias the input
+	 * @param input number of vectors
+	 */
+	template<Length_t length>
+	CIN_MATH_INLINE void ConvertArray(const Vector<length, float>* CIN_MATH_RESTRICT input, Vector<length, Half>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Converts half precision vectors to float vectors
+	 *
+	 * @param input half precision vectors
+	 * @param output vectors, must not alias the input
+	 * @param input number of vectors
+	 */
+	template<Length_t length>
+	CIN_MATH_INLINE void ConvertArray(const Vector<length, Half>* CIN_MATH_RESTRICT input, Vector<length, float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Converts float matrices to half precision matrices
+	 *
+	 * @param input matrices
+	 * @param output half precision matrices, must not alias the input
+	 * @param input number of matrices
+	 */
+	CIN_MATH_INLINE void ConvertArray(const Matrix<4, 4, float>* CIN_MATH_RESTRICT input, Matrix4h* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Converts half precision matrices to float matrices
+	 *
+	 * @param input half precision matrices
+	 * @param output matrices, must not alias the input
+	 * @param input number of matrices
+	 */
+	CIN_MATH_INLINE void ConvertArray(const Matrix4h* CIN_MATH_RESTRICT input, Matrix<4, 4, float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+namespace CinMath {
+	CIN_MATH_INLINE void ConvertArray(const float* CIN_MATH_RESTRICT input, Half* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		std::size_t i{ 0U };
+#ifdef CIN_MATH_USE_F16C
+		for (; i + 8U <= count; i += 8U)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm256_cvtps_ph(_mm256_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+
+		for (; i + 4U <= count; i += 4U)
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_cvtps_ph(_mm_loadu_ps(input + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#endif
+		/* Remainder */
+		for (; i < count; ++i)
+			output[i] = Half{ input[i] };
+	}
+
+	CIN_MATH_INLINE void ConvertArray(const Half* CIN_MATH_RESTRICT input, float* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		std::size_t i{ 0U };
+#ifdef CIN_MATH_USE_F16C
+		for (; i + 8U <= count; i += 8U)
+			_mm256_storeu_ps(output + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))));
+
+		for (; i + 4U <= count; i += 4U)
+			_mm_storeu_ps(output + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + i))));
+#endif
+		/* Remainder */
+		for (; i < count; ++i)
+			output[i] = static_cast<float>(input[i]);
+	}
+
+	template<Length_t length>
+	CIN_MATH_INLINE void ConvertArray(const Vector<length, float>* CIN_MATH_RESTRICT input, Vector<length, Half>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		static_assert(sizeof(Vector<length, float>) == length * sizeof(float) && sizeof(Vector<length, Half>) == length * sizeof(Half), "Vectors must be tightly packed");
+		ConvertArray(reinterpret_cast<const float*>(input), reinterpret_cast<Half*>(output), count * length);
+	}
+
+	template<Length_t length>
+	CIN_MATH_INLINE void ConvertArray(const Vector<length, Half>* CIN_MATH_RESTRICT input, Vector<length, float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		static_assert(sizeof(Vector<length, float>) == length * sizeof(float) && sizeof(Vector<length, Half>) == length * sizeof(Half), "Vectors must be tightly packed");
+		ConvertArray(reinterpret_cast<const Half*>(input), reinterpret_cast<float*>(output), count * length);
+	}
+
+	CIN_MATH_INLINE void ConvertArray(const Matrix<4, 4, float>* CIN_MATH_RESTRICT input, Matrix4h* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		static_assert(sizeof(Matrix<4, 4, float>) == 16U * sizeof(float) && sizeof(Matrix4h) == 16U * sizeof(Half), "Matrices must be tightly packed");
+		ConvertArray(reinterpret_cast<const float*>(input), reinterpret_cast<Half*>(output), count * 16U);
+	}
+
+	CIN_MATH_INLINE void ConvertArray(const Matrix4h* CIN_MATH_RESTRICT input, Matrix<4, 4, float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		static_assert(sizeof(Matrix<4, 4, float>) == 16U * sizeof(float) && sizeof(Matrix4h) == 16U * sizeof(Half), "Matrices must be tightly packed");
+		ConvertArray(reinterpret_cast<const Half*>(input), reinterpret_cast<float*>(output), count * 16U);
+	}
+}
@@ -787,39 +787,37 @@ namespace CinMath {
 		return result;
 	}
 
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+	namespace Implementation {
+		/*
+		 * row0 * x + row1 * y + row2 * z + row3 * w, summed left to right. Shared by operator*(Matrix4, Vector4) and
+		 * the batch kernels so both give the same bits, with fused multiply-adds when the build has them
+		 */
+		CIN_MATH_INLINE __m128 CIN_MATH_CALL TransformVector(const __m128 row0, const __m128 row1, const __m128 row2, const __m128 row3, const __m128 vector) noexcept
+		{
+			__m128 result{ _mm_mul_ps(_mm_shuffle_ps(vector, vector, 0b00'00'00'00), row0) };
+#if ((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX2_BIT)) && (defined(__FMA__) || defined(_MSC_VER))
+			result = _mm_fmadd_ps(_mm_shuffle_ps(vector, vector, 0b01'01'01'01), row1, result);
+			result = _mm_fmadd_ps(_mm_shuffle_ps(vector, vector, 0b10'10'10'10), row2, result);
+			result = _mm_fmadd_ps(_mm_shuffle_ps(vector, vector, 0b11'11'11'11), row3, result);
+#else
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, 0b01'01'01'01), row1));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, 0b10'10'10'10), row2));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vector, vector, 0b11'11'11'11), row3));
+#endif
+			return result;
+		}
+	}
+#endif
+
 	[[nodiscard]] CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL operator*(const Matrix<4, 4, float>& lhs, const Vector<4, float>& rhs) noexcept
 	{
 		Vector<4, float> result;
 #if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
-		result[0] = rhs[0] * lhs[0] + rhs[1] * lhs[4] + rhs[2] * lhs[8] + rhs[3] * lhs[12];
-		result[1] = rhs[0] * lhs[1] + rhs[1] * lhs[5] + rhs[2] * lhs[9] + rhs[3] * lhs[13];
-		result[2] = rhs[0] * lhs[2] + rhs[1] * lhs[6] + rhs[2] * lhs[10] + rhs[3] * lhs[14];
-		result[3] = rhs[0] * lhs[3] + rhs[1] * lhs[7] + rhs[2] * lhs[11] + rhs[3] * lhs[15];
-		
-		/* 10 instructions more than sse.. */
-		// const __m256 e0{ _mm256_set_m128(_mm_shuffle_ps(rhs.data, rhs.data, 0b01'01'01'01), _mm_shuffle_ps(rhs.data, rhs.data, 0b00'00'00'00)) };
-		// const __m256 m0{ _mm256_mul_ps(e0, lhs.data[0]) };
-		// 	
-		// result.data = _mm_add_ps(result.data, _mm256_extractf128_ps(m0, 0b00'00'00'00));
-		// result.data = _mm_add_ps(result.data, _mm256_extractf128_ps(m0, 0b01'01'01'01));
-		// 
-		// const __m256 e1{ _mm256_set_m128(_mm_shuffle_ps(rhs.data, rhs.data, 0b11'11'11'11), _mm_shuffle_ps(rhs.data, rhs.data, 0b10'10'10'10)) };
-		// const __m256 m1{ _mm256_mul_ps(e1, lhs.data[1]) };
-		// 
-		// result.data = _mm_add_ps(result.data, _mm256_extractf128_ps(m1, 0b00'00'00'00));
-		// result.data = _mm_add_ps(result.data, _mm256_extractf128_ps(m1, 0b01'01'01'01));
+		/* The rows are stored in pairs, loading them one by one is cheaper than splitting the 256 bit registers */
+		result.data = Implementation::TransformVector(_mm_loadu_ps(lhs.raw), _mm_loadu_ps(lhs.raw + 4), _mm_loadu_ps(lhs.raw + 8), _mm_loadu_ps(lhs.raw + 12), rhs.data);
 #elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
-		const __m128 e0{ _mm_shuffle_ps(rhs.data, rhs.data, 0b00'00'00'00) };
-		result.data = _mm_mul_ps(e0, lhs.data[0]);
-
-		const __m128 e1{ _mm_mul_ps(_mm_shuffle_ps(rhs.data, rhs.data, 0b01'01'01'01), lhs.data[1]) };
-		result.data = _mm_add_ps(result.data, e1);
-		
-		const __m128 e2{ _mm_mul_ps(_mm_shuffle_ps(rhs.data, rhs.data, 0b10'10'10'10), lhs.data[2]) };
-		result.data = _mm_add_ps(result.data, e2);
-
-		const __m128 e3{ _mm_mul_ps(_mm_shuffle_ps(rhs.data, rhs.data, 0b11'11'11'11), lhs.data[3]) };
-		result.data = _mm_add_ps(result.data, e3);
+		result.data = Implementation::TransformVector(lhs.data[0], lhs.data[1], lhs.data[2], lhs.data[3], rhs.data);
 #else
 		result[0] = rhs[0] * lhs[0] + rhs[1] * lhs[4] + rhs[2] * lhs[8] + rhs[3] * lhs[12];
 		result[1] = rhs[0] * lhs[1] + rhs[1] * lhs[5] + rhs[2] * lhs[9] + rhs[3] * lhs[13];
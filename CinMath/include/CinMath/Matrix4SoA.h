@@ -0,0 +1,256 @@
+#pragma once
+
+namespace CinMath {
+	/*
+	 * Structure of arrays types for kernels that work on eight matrices (or vectors) at once. Where Matrix<4, 4, float>
+	 * keeps one matrix in a register and needs shuffles to reach across its rows, Matrix4SoA keeps one element of eight
+	 * matrices in one register, so every formula of the scalar code runs as is, eight lanes at a time, with no
+	 * shuffles at all. A Matrix4SoA has the memory layout of one block of TransposeArray (see MatrixLaneWidth)
+	 */
+
+	/* Eight floats, one per lane, in one AVX register (two SSE registers) */
+	class ScalarSoA final
+	{
+	public:
+		CIN_MATH_INLINE explicit ScalarSoA() noexcept
+			:
+			raw{}
+		{}
+
+		/* Broadcast */
+		CIN_MATH_INLINE explicit ScalarSoA(const float value) noexcept;
+
+		/**
+		 * Loads eight consecutive values
+		 *
+		 * @param input values, no alignment required
+		 * @return lanes
+		 */
+		[[nodiscard]] static CIN_MATH_INLINE ScalarSoA Load(const float* values) noexcept;
+
+		/**
+		 * Stores the lanes to eight consecutive values
+		 *
+		 * @param output values, no alignment required
+		 */
+		CIN_MATH_INLINE void Store(float* values) const noexcept;
+	public:
+		union
+		{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+			__m256 data;
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+			__m128 data[2];
+#endif
+			alignas(32) float raw[MatrixLaneWidth];
+		};
+	};
+
+	/* Eight Vector<3, float>, x, y and z of every lane */
+	class Vector3SoA final
+	{
+	public:
+		CIN_MATH_INLINE explicit Vector3SoA() noexcept = default;
+
+		CIN_MATH_INLINE explicit Vector3SoA(const ScalarSoA& x, const ScalarSoA& y, const ScalarSoA& z) noexcept
+			:
+			x(x),
+			y(y),
+			z(z)
+		{}
+
+		/**
+		 * Reads one lane
+		 *
+		 * @param input lane, less than MatrixLaneWidth
+		 * @return vector of the lane
+		 */
+		[[nodiscard]] CIN_MATH_INLINE Vector<3, float> Get(const std::size_t lane) const noexcept;
+
+		/**
+		 * Writes one lane
+		 *
+		 * @param input lane, less than MatrixLaneWidth
+		 * @param input vector
+		 */
+		CIN_MATH_INLINE void Set(const std::size_t lane, const Vector<3, float>& vector) noexcept;
+	public:
+		ScalarSoA x, y, z;
+	};
+
+	/* Eight Vector<4, float>, x, y, z and w of every lane */
+	class Vector4SoA final
+	{
+	public:
+		CIN_MATH_INLINE explicit Vector4SoA() noexcept = default;
+
+		CIN_MATH_INLINE explicit Vector4SoA(const ScalarSoA& x, const ScalarSoA& y, const ScalarSoA& z, const ScalarSoA& w) noexcept
+			:
+			x(x),
+			y(y),
+			z(z),
+			w(w)
+		{}
+
+		/**
+		 * Reads one lane
+		 *
+		 * @param input lane, less than MatrixLaneWidth
+		 * @return vector of the lane
+		 */
+		[[nodiscard]] CIN_MATH_INLINE Vector<4, float> Get(const std::size_t lane) const noexcept;
+
+		/**
+		 * Writes one lane
+		 *
+		 * @param input lane, less than MatrixLaneWidth
+		 * @param input vector
+		 */
+		CIN_MATH_INLINE void Set(const std::size_t lane, const Vector<4, float>& vector) noexcept;
+	public:
+		ScalarSoA x, y, z, w;
+	};
+
+	/* Eight TQuaternion<float>, the scalar and vector parts of every lane */
+	class QuaternionSoA final
+	{
+	public:
+		CIN_MATH_INLINE explicit QuaternionSoA() noexcept = default;
+
+		/**
+		 * Reads one lane
+		 *
+		 * @param input lane, less than MatrixLaneWidth
+		 * @return quaternion of the lane
+		 */
+		[[nodiscard]] CIN_MATH_INLINE TQuaternion<float> Get(const std::size_t lane) const noexcept;
+
+		/**
+		 * Writes one lane
+		 *
+		 * @param input lane, less than MatrixLaneWidth
+		 * @param input quaternion
+		 */
+		CIN_MATH_INLINE void Set(const std::size_t lane, const TQuaternion<float>& quaternion) noexcept;
+	public:
+		ScalarSoA scalar;
+		Vector3SoA vector;
+	};
+
+	/* Eight Matrix<4, 4, float>, elements[i] holds raw[i] of every lane */
+	class Matrix4SoA final
+	{
+	public:
+		CIN_MATH_INLINE explicit Matrix4SoA() noexcept = default;
+
+		/* Identity in every lane */
+		[[nodiscard]] static CIN_MATH_INLINE Matrix4SoA Identity() noexcept;
+
+		/**
+		 * Loads one block of the lane layout written by TransposeArray
+		 *
+		 * @param input 16 * MatrixLaneWidth values, no alignment required
+		 * @return matrices
+		 */
+		[[nodiscard]] static CIN_MATH_INLINE Matrix4SoA Load(const float* lanes) noexcept;
+
+		/**
+		 * Stores the matrices as one block of the lane layout read by TransposeArray
+		 *
+		 * @param output 16 * MatrixLaneWidth values, no alignment required
+		 */
+		CIN_MATH_INLINE void Store(float* lanes) const noexcept;
+
+		/**
+		 * Reads one lane
+		 *
+		 * @param input lane, less than MatrixLaneWidth
+		 * @return matrix of the lane
+		 */
+		[[nodiscard]] CIN_MATH_INLINE Matrix<4, 4, float> Get(const std::size_t lane) const noexcept;
+
+		/**
+		 * Writes one lane
+		 *
+		 * @param input lane, less than MatrixLaneWidth
+		 * @param input matrix
+		 */
+		CIN_MATH_INLINE void Set(const std::size_t lane, const Matrix<4, 4, float>& matrix) noexcept;
+	public:
+		ScalarSoA elements[16];
+	};
+
+	static_assert(sizeof(Matrix4SoA) == 16U * MatrixLaneWidth * sizeof(float), "Matrix4SoA must match one block of the lane layout");
+
+	/**
+	 * Products of the lanes, result = lhs * rhs in every lane
+	 *
+	 * @param input left hand side matrices
+	 * @param input right hand side matrices
+	 * @return products
+	 */
+	[[nodiscard]] CIN_MATH_INLINE Matrix4SoA CIN_MATH_CALL operator*(const Matrix4SoA& lhs, const Matrix4SoA& rhs) noexcept;
+
+	/**
+	 * Transforms the vector of every lane by the matrix of the lane, matrix * vector
+	 *
+	 * @param input matrices
+	 * @param input vectors
+	 * @return transformed vectors
+	 */
+	[[nodiscard]] CIN_MATH_INLINE Vector4SoA CIN_MATH_CALL operator*(const Matrix4SoA& matrix, const Vector4SoA& vector) noexcept;
+
+	/**
+	 * Transposes the matrix of every lane, only the registers are renamed
+	 *
+	 * @param input matrices
+	 * @return transposed matrices
+	 */
+	[[nodiscard]] CIN_MATH_INLINE Matrix4SoA CIN_MATH_CALL Transpose(const Matrix4SoA& matrix) noexcept;
+
+	/**
+	 * Determinants of the lanes
+	 *
+	 * @param input matrices
+	 * @return determinant of every lane
+	 */
+	[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL Determinant(const Matrix4SoA& matrix) noexcept;
+
+	/**
+	 * Inverses of the lanes, a singular lane gives infinities or NaNs and leaves the other lanes untouched
+	 *
+	 * @param input matrices
+	 * @return inverse of every lane
+	 */
+	[[nodiscard]] CIN_MATH_INLINE Matrix4SoA CIN_MATH_CALL Inverse(const Matrix4SoA& matrix) noexcept;
+
+	/**
+	 * Decompose of every lane, see Decompose(Matrix4). The branches of Shepperd's method become selects, every lane
+	 * computes one square root and one division for its rotation
+	 *
+	 * @param input matrices, the scale components must not be zero
+	 * @param output translations
+	 * @param output rotations in unit form
+	 * @param output scales
+	 */
+	CIN_MATH_INLINE void CIN_MATH_CALL Decompose(const Matrix4SoA& matrix, Vector3SoA& translation, QuaternionSoA& rotation, Vector3SoA& scale) noexcept;
+
+	/**
+	 * DecomposeOrthonormal of every lane, for rigid transformations without scale
+	 *
+	 * @param input matrices, the rotation parts must be orthonormal
+	 * @param output translations
+	 * @param output rotations in unit form
+	 */
+	CIN_MATH_INLINE void CIN_MATH_CALL DecomposeOrthonormal(const Matrix4SoA& matrix, Vector3SoA& translation, QuaternionSoA& rotation) noexcept;
+
+	/**
+	 * Compose of every lane, translation * rotation * scale
+	 *
+	 * @param input translations
+	 * @param input rotations in unit form
+	 * @param input scales
+	 * @return affine matrices
+	 */
+	[[nodiscard]] CIN_MATH_INLINE Matrix4SoA CIN_MATH_CALL Compose(const Vector3SoA& translation, const QuaternionSoA& rotation, const Vector3SoA& scale) noexcept;
+}
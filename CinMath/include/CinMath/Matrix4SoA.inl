@@ -0,0 +1,475 @@
+#pragma once
+
+namespace CinMath {
+	CIN_MATH_INLINE ScalarSoA::ScalarSoA(const float value) noexcept
+	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		data = _mm256_set1_ps(value);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		data[0] = _mm_set1_ps(value);
+		data[1] = data[0];
+#else
+		for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+			raw[lane] = value;
+#endif
+	}
+
+	CIN_MATH_INLINE ScalarSoA ScalarSoA::Load(const float* values) noexcept
+	{
+		ScalarSoA result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_loadu_ps(values);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data[0] = _mm_loadu_ps(values);
+		result.data[1] = _mm_loadu_ps(values + 4);
+#else
+		std::memcpy(result.raw, values, sizeof(result.raw));
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE void ScalarSoA::Store(float* values) const noexcept
+	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		_mm256_storeu_ps(values, data);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		_mm_storeu_ps(values, data[0]);
+		_mm_storeu_ps(values + 4, data[1]);
+#else
+		std::memcpy(values, raw, sizeof(raw));
+#endif
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL operator+(const ScalarSoA& lhs, const ScalarSoA& rhs) noexcept
+	{
+		ScalarSoA result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_add_ps(lhs.data, rhs.data);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data[0] = _mm_add_ps(lhs.data[0], rhs.data[0]);
+		result.data[1] = _mm_add_ps(lhs.data[1], rhs.data[1]);
+#else
+		for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+			result.raw[lane] = lhs.raw[lane] + rhs.raw[lane];
+#endif
+		return result;
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL operator-(const ScalarSoA& lhs, const ScalarSoA& rhs) noexcept
+	{
+		ScalarSoA result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_sub_ps(lhs.data, rhs.data);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data[0] = _mm_sub_ps(lhs.data[0], rhs.data[0]);
+		result.data[1] = _mm_sub_ps(lhs.data[1], rhs.data[1]);
+#else
+		for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+			result.raw[lane] = lhs.raw[lane] - rhs.raw[lane];
+#endif
+		return result;
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL operator*(const ScalarSoA& lhs, const ScalarSoA& rhs) noexcept
+	{
+		ScalarSoA result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_mul_ps(lhs.data, rhs.data);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data[0] = _mm_mul_ps(lhs.data[0], rhs.data[0]);
+		result.data[1] = _mm_mul_ps(lhs.data[1], rhs.data[1]);
+#else
+		for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+			result.raw[lane] = lhs.raw[lane] * rhs.raw[lane];
+#endif
+		return result;
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL operator/(const ScalarSoA& lhs, const ScalarSoA& rhs) noexcept
+	{
+		ScalarSoA result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_div_ps(lhs.data, rhs.data);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data[0] = _mm_div_ps(lhs.data[0], rhs.data[0]);
+		result.data[1] = _mm_div_ps(lhs.data[1], rhs.data[1]);
+#else
+		for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+			result.raw[lane] = lhs.raw[lane] / rhs.raw[lane];
+#endif
+		return result;
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL operator-(const ScalarSoA& scalar) noexcept
+	{
+		return ScalarSoA{ 0.0f } - scalar;
+	}
+
+	namespace Implementation {
+		/* Lane masks, all bits set where the comparison holds */
+		[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL GreaterThan(const ScalarSoA& lhs, const ScalarSoA& rhs) noexcept
+		{
+			ScalarSoA result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+			result.data = _mm256_cmp_ps(lhs.data, rhs.data, _CMP_GT_OQ);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+			result.data[0] = _mm_cmpgt_ps(lhs.data[0], rhs.data[0]);
+			result.data[1] = _mm_cmpgt_ps(lhs.data[1], rhs.data[1]);
+#else
+			for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+				result.raw[lane] = std::bit_cast<float>(lhs.raw[lane] > rhs.raw[lane] ? 0xFFFF'FFFFU : 0U);
+#endif
+			return result;
+		}
+
+		[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL And(const ScalarSoA& lhs, const ScalarSoA& rhs) noexcept
+		{
+			ScalarSoA result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+			result.data = _mm256_and_ps(lhs.data, rhs.data);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+			result.data[0] = _mm_and_ps(lhs.data[0], rhs.data[0]);
+			result.data[1] = _mm_and_ps(lhs.data[1], rhs.data[1]);
+#else
+			for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+				result.raw[lane] = std::bit_cast<float>(std::bit_cast<std::uint32_t>(lhs.raw[lane]) & std::bit_cast<std::uint32_t>(rhs.raw[lane]));
+#endif
+			return result;
+		}
+
+		/* ifTrue where the mask is set, ifFalse elsewhere */
+		[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL Select(const ScalarSoA& mask, const ScalarSoA& ifTrue, const ScalarSoA& ifFalse) noexcept
+		{
+			ScalarSoA result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+			result.data = _mm256_blendv_ps(ifFalse.data, ifTrue.data, mask.data);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+			result.data[0] = _mm_or_ps(_mm_and_ps(mask.data[0], ifTrue.data[0]), _mm_andnot_ps(mask.data[0], ifFalse.data[0]));
+			result.data[1] = _mm_or_ps(_mm_and_ps(mask.data[1], ifTrue.data[1]), _mm_andnot_ps(mask.data[1], ifFalse.data[1]));
+#else
+			for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+				result.raw[lane] = std::bit_cast<std::uint32_t>(mask.raw[lane]) != 0U ? ifTrue.raw[lane] : ifFalse.raw[lane];
+#endif
+			return result;
+		}
+
+		[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL Sqrt(const ScalarSoA& value) noexcept
+		{
+			ScalarSoA result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+			result.data = _mm256_sqrt_ps(value.data);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+			result.data[0] = _mm_sqrt_ps(value.data[0]);
+			result.data[1] = _mm_sqrt_ps(value.data[1]);
+#else
+			for (std::size_t lane{ 0U }; lane < MatrixLaneWidth; ++lane)
+				result.raw[lane] = std::sqrt(value.raw[lane]);
+#endif
+			return result;
+		}
+
+		/* MatrixDecompose::Rotation with the four cases evaluated in every lane and selected by precedence */
+		CIN_MATH_INLINE QuaternionSoA CIN_MATH_CALL DecomposeRotation(const Vector3SoA& column0, const Vector3SoA& column1, const Vector3SoA& column2) noexcept
+		{
+			const ScalarSoA one{ 1.0f };
+			const ScalarSoA half{ 0.5f };
+
+			const ScalarSoA& r00{ column0.x }; const ScalarSoA& r10{ column0.y }; const ScalarSoA& r20{ column0.z };
+			const ScalarSoA& r01{ column1.x }; const ScalarSoA& r11{ column1.y }; const ScalarSoA& r21{ column1.z };
+			const ScalarSoA& r02{ column2.x }; const ScalarSoA& r12{ column2.y }; const ScalarSoA& r22{ column2.z };
+
+			/* Later cases only apply where the earlier ones do not, the selects run from the last case to the first */
+			const ScalarSoA case0{ GreaterThan(r00 + r11 + r22, ScalarSoA{ 0.0f }) };
+			const ScalarSoA case1{ And(GreaterThan(r00, r11), GreaterThan(r00, r22)) };
+			const ScalarSoA case2{ GreaterThan(r11, r22) };
+
+			ScalarSoA diagonal{ Select(case2, one - r00 + r11 - r22, one - r00 - r11 + r22) };
+			diagonal = Select(case1, one + r00 - r11 - r22, diagonal);
+			diagonal = Select(case0, one + r00 + r11 + r22, diagonal);
+
+			const ScalarSoA root{ Sqrt(diagonal) };
+			const ScalarSoA quarter{ half * root };
+			const ScalarSoA inverse{ half / root };
+
+			const ScalarSoA d21{ (r21 - r12) * inverse };
+			const ScalarSoA d02{ (r02 - r20) * inverse };
+			const ScalarSoA d10{ (r10 - r01) * inverse };
+			const ScalarSoA s01{ (r01 + r10) * inverse };
+			const ScalarSoA s02{ (r02 + r20) * inverse };
+			const ScalarSoA s12{ (r12 + r21) * inverse };
+
+			QuaternionSoA result;
+			result.scalar = Select(case0, quarter, Select(case1, d21, Select(case2, d02, d10)));
+			result.vector.x = Select(case0, d21, Select(case1, quarter, Select(case2, s01, s02)));
+			result.vector.y = Select(case0, d02, Select(case1, s01, Select(case2, quarter, s12)));
+			result.vector.z = Select(case0, d10, Select(case1, s02, Select(case2, s12, quarter)));
+
+			return result;
+		}
+	}
+
+	CIN_MATH_INLINE Vector<3, float> Vector3SoA::Get(const std::size_t lane) const noexcept
+	{
+		return Vector<3, float>{ x.raw[lane], y.raw[lane], z.raw[lane] };
+	}
+
+	CIN_MATH_INLINE void Vector3SoA::Set(const std::size_t lane, const Vector<3, float>& vector) noexcept
+	{
+		x.raw[lane] = vector.raw[0];
+		y.raw[lane] = vector.raw[1];
+		z.raw[lane] = vector.raw[2];
+	}
+
+	CIN_MATH_INLINE Vector<4, float> Vector4SoA::Get(const std::size_t lane) const noexcept
+	{
+		return Vector<4, float>{ x.raw[lane], y.raw[lane], z.raw[lane], w.raw[lane] };
+	}
+
+	CIN_MATH_INLINE void Vector4SoA::Set(const std::size_t lane, const Vector<4, float>& vector) noexcept
+	{
+		x.raw[lane] = vector.raw[0];
+		y.raw[lane] = vector.raw[1];
+		z.raw[lane] = vector.raw[2];
+		w.raw[lane] = vector.raw[3];
+	}
+
+	CIN_MATH_INLINE TQuaternion<float> QuaternionSoA::Get(const std::size_t lane) const noexcept
+	{
+		return TQuaternion<float>{ scalar.raw[lane], vector.x.raw[lane], vector.y.raw[lane], vector.z.raw[lane] };
+	}
+
+	CIN_MATH_INLINE void QuaternionSoA::Set(const std::size_t lane, const TQuaternion<float>& quaternion) noexcept
+	{
+		scalar.raw[lane] = quaternion.raw[0];
+		vector.x.raw[lane] = quaternion.raw[1];
+		vector.y.raw[lane] = quaternion.raw[2];
+		vector.z.raw[lane] = quaternion.raw[3];
+	}
+
+	CIN_MATH_INLINE Matrix4SoA Matrix4SoA::Identity() noexcept
+	{
+		Matrix4SoA result;
+		const ScalarSoA one{ 1.0f };
+		result.elements[0] = one;
+		result.elements[5] = one;
+		result.elements[10] = one;
+		result.elements[15] = one;
+
+		return result;
+	}
+
+	CIN_MATH_INLINE Matrix4SoA Matrix4SoA::Load(const float* lanes) noexcept
+	{
+		Matrix4SoA result;
+		for (std::size_t element{ 0U }; element < 16U; ++element)
+			result.elements[element] = ScalarSoA::Load(lanes + element * MatrixLaneWidth);
+
+		return result;
+	}
+
+	CIN_MATH_INLINE void Matrix4SoA::Store(float* lanes) const noexcept
+	{
+		for (std::size_t element{ 0U }; element < 16U; ++element)
+			elements[element].Store(lanes + element * MatrixLaneWidth);
+	}
+
+	CIN_MATH_INLINE Matrix<4, 4, float> Matrix4SoA::Get(const std::size_t lane) const noexcept
+	{
+		Matrix<4, 4, float> result;
+		for (std::size_t element{ 0U }; element < 16U; ++element)
+			result.raw[element] = elements[element].raw[lane];
+
+		return result;
+	}
+
+	CIN_MATH_INLINE void Matrix4SoA::Set(const std::size_t lane, const Matrix<4, 4, float>& matrix) noexcept
+	{
+		for (std::size_t element{ 0U }; element < 16U; ++element)
+			elements[element].raw[lane] = matrix.raw[element];
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE Matrix4SoA CIN_MATH_CALL operator*(const Matrix4SoA& lhs, const Matrix4SoA& rhs) noexcept
+	{
+		const ScalarSoA* const a{ lhs.elements };
+		const ScalarSoA* const b{ rhs.elements };
+
+		/* Same products and summation order as the scalar operator* */
+		Matrix4SoA result;
+		for (std::size_t column{ 0U }; column < 4U; ++column)
+			for (std::size_t row{ 0U }; row < 4U; ++row)
+				result.elements[column * 4U + row] =
+					b[column * 4U + 0U] * a[0U + row] + b[column * 4U + 1U] * a[4U + row] +
+					b[column * 4U + 2U] * a[8U + row] + b[column * 4U + 3U] * a[12U + row];
+
+		return result;
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE Vector4SoA CIN_MATH_CALL operator*(const Matrix4SoA& matrix, const Vector4SoA& vector) noexcept
+	{
+		/* The rows of the stored matrix weighted by the vector components, as operator*(Matrix4, Vector4) */
+		const ScalarSoA* const m{ matrix.elements };
+		return Vector4SoA
+		{
+			vector.x * m[0] + vector.y * m[4] + vector.z * m[8] + vector.w * m[12],
+			vector.x * m[1] + vector.y * m[5] + vector.z * m[9] + vector.w * m[13],
+			vector.x * m[2] + vector.y * m[6] + vector.z * m[10] + vector.w * m[14],
+			vector.x * m[3] + vector.y * m[7] + vector.z * m[11] + vector.w * m[15]
+		};
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE Matrix4SoA CIN_MATH_CALL Transpose(const Matrix4SoA& matrix) noexcept
+	{
+		Matrix4SoA result;
+		for (std::size_t row{ 0U }; row < 4U; ++row)
+			for (std::size_t column{ 0U }; column < 4U; ++column)
+				result.elements[column * 4U + row] = matrix.elements[row * 4U + column];
+
+		return result;
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE ScalarSoA CIN_MATH_CALL Determinant(const Matrix4SoA& matrix) noexcept
+	{
+		/* Expansion along the first row with the 2x2 minors of the last two rows, as Determinant(Matrix4) */
+		const ScalarSoA* const m{ matrix.elements };
+		const ScalarSoA e00{ m[10] * m[15] - m[14] * m[11] };
+		const ScalarSoA e01{ m[9] * m[15] - m[13] * m[11] };
+		const ScalarSoA e02{ m[9] * m[14] - m[13] * m[10] };
+		const ScalarSoA e03{ m[8] * m[15] - m[12] * m[11] };
+		const ScalarSoA e04{ m[8] * m[14] - m[12] * m[10] };
+		const ScalarSoA e05{ m[8] * m[13] - m[12] * m[9] };
+
+		const ScalarSoA m00{ m[5] * e00 - m[6] * e01 + m[7] * e02 };
+		const ScalarSoA m01{ m[4] * e00 - m[6] * e03 + m[7] * e04 };
+		const ScalarSoA m02{ m[4] * e01 - m[5] * e03 + m[7] * e05 };
+		const ScalarSoA m03{ m[4] * e02 - m[5] * e04 + m[6] * e05 };
+
+		return m[0] * m00 - m[1] * m01 + m[2] * m02 - m[3] * m03;
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE Matrix4SoA CIN_MATH_CALL Inverse(const Matrix4SoA& matrix) noexcept
+	{
+		const ScalarSoA* const m{ matrix.elements };
+
+		/* 2x2 minors of the last two rows (a) and of the second row with the last two (b), shared by the cofactors */
+		const ScalarSoA a2323{ m[10] * m[15] - m[11] * m[14] };
+		const ScalarSoA a1323{ m[9] * m[15] - m[11] * m[13] };
+		const ScalarSoA a1223{ m[9] * m[14] - m[10] * m[13] };
+		const ScalarSoA a0323{ m[8] * m[15] - m[11] * m[12] };
+		const ScalarSoA a0223{ m[8] * m[14] - m[10] * m[12] };
+		const ScalarSoA a0123{ m[8] * m[13] - m[9] * m[12] };
+
+		const ScalarSoA b2313{ m[6] * m[15] - m[7] * m[14] };
+		const ScalarSoA b1313{ m[5] * m[15] - m[7] * m[13] };
+		const ScalarSoA b1213{ m[5] * m[14] - m[6] * m[13] };
+		const ScalarSoA b2312{ m[6] * m[11] - m[7] * m[10] };
+		const ScalarSoA b1312{ m[5] * m[11] - m[7] * m[9] };
+		const ScalarSoA b1212{ m[5] * m[10] - m[6] * m[9] };
+		const ScalarSoA b0313{ m[4] * m[15] - m[7] * m[12] };
+		const ScalarSoA b0213{ m[4] * m[14] - m[6] * m[12] };
+		const ScalarSoA b0312{ m[4] * m[11] - m[7] * m[8] };
+		const ScalarSoA b0212{ m[4] * m[10] - m[6] * m[8] };
+		const ScalarSoA b0113{ m[4] * m[13] - m[5] * m[12] };
+		const ScalarSoA b0112{ m[4] * m[9] - m[5] * m[8] };
+
+		/* Cofactors of the first row give the determinant */
+		const ScalarSoA c00{ m[5] * a2323 - m[6] * a1323 + m[7] * a1223 };
+		const ScalarSoA c01{ m[4] * a2323 - m[6] * a0323 + m[7] * a0223 };
+		const ScalarSoA c02{ m[4] * a1323 - m[5] * a0323 + m[7] * a0123 };
+		const ScalarSoA c03{ m[4] * a1223 - m[5] * a0223 + m[6] * a0123 };
+		const ScalarSoA oneOverDeterminant{ ScalarSoA{ 1.0f } / (m[0] * c00 - m[1] * c01 + m[2] * c02 - m[3] * c03) };
+
+		/* The adjugate, already transposed */
+		Matrix4SoA result;
+		ScalarSoA* const r{ result.elements };
+		r[0] = c00 * oneOverDeterminant;
+		r[1] = -(m[1] * a2323 - m[2] * a1323 + m[3] * a1223) * oneOverDeterminant;
+		r[2] = (m[1] * b2313 - m[2] * b1313 + m[3] * b1213) * oneOverDeterminant;
+		r[3] = -(m[1] * b2312 - m[2] * b1312 + m[3] * b1212) * oneOverDeterminant;
+
+		r[4] = -c01 * oneOverDeterminant;
+		r[5] = (m[0] * a2323 - m[2] * a0323 + m[3] * a0223) * oneOverDeterminant;
+		r[6] = -(m[0] * b2313 - m[2] * b0313 + m[3] * b0213) * oneOverDeterminant;
+		r[7] = (m[0] * b2312 - m[2] * b0312 + m[3] * b0212) * oneOverDeterminant;
+
+		r[8] = c02 * oneOverDeterminant;
+		r[9] = -(m[0] * a1323 - m[1] * a0323 + m[3] * a0123) * oneOverDeterminant;
+		r[10] = (m[0] * b1313 - m[1] * b0313 + m[3] * b0113) * oneOverDeterminant;
+		r[11] = -(m[0] * b1312 - m[1] * b0312 + m[3] * b0112) * oneOverDeterminant;
+
+		r[12] = -c03 * oneOverDeterminant;
+		r[13] = (m[0] * a1223 - m[1] * a0223 + m[2] * a0123) * oneOverDeterminant;
+		r[14] = -(m[0] * b1213 - m[1] * b0213 + m[2] * b0113) * oneOverDeterminant;
+		r[15] = (m[0] * b1212 - m[1] * b0212 + m[2] * b0112) * oneOverDeterminant;
+
+		return result;
+	}
+
+	CIN_MATH_INLINE void CIN_MATH_CALL Decompose(const Matrix4SoA& matrix, Vector3SoA& translation, QuaternionSoA& rotation, Vector3SoA& scale) noexcept
+	{
+		const ScalarSoA* const m{ matrix.elements };
+		const Vector3SoA column0{ m[0], m[1], m[2] };
+		const Vector3SoA column1{ m[4], m[5], m[6] };
+		const Vector3SoA column2{ m[8], m[9], m[10] };
+
+		translation = Vector3SoA{ m[12], m[13], m[14] };
+		scale.x = Implementation::Sqrt(column0.x * column0.x + column0.y * column0.y + column0.z * column0.z);
+		scale.y = Implementation::Sqrt(column1.x * column1.x + column1.y * column1.y + column1.z * column1.z);
+		scale.z = Implementation::Sqrt(column2.x * column2.x + column2.y * column2.y + column2.z * column2.z);
+
+		/* Mirroring lanes (negative determinant) get a negative x scale */
+		const ScalarSoA determinant
+		{
+			(column0.y * column1.z - column0.z * column1.y) * column2.x +
+			(column0.z * column1.x - column0.x * column1.z) * column2.y +
+			(column0.x * column1.y - column0.y * column1.x) * column2.z
+		};
+		scale.x = Implementation::Select(Implementation::GreaterThan(ScalarSoA{ 0.0f }, determinant), -scale.x, scale.x);
+
+		const ScalarSoA inverseX{ ScalarSoA{ 1.0f } / scale.x };
+		const ScalarSoA inverseY{ ScalarSoA{ 1.0f } / scale.y };
+		const ScalarSoA inverseZ{ ScalarSoA{ 1.0f } / scale.z };
+		rotation = Implementation::DecomposeRotation(
+			Vector3SoA{ column0.x * inverseX, column0.y * inverseX, column0.z * inverseX },
+			Vector3SoA{ column1.x * inverseY, column1.y * inverseY, column1.z * inverseY },
+			Vector3SoA{ column2.x * inverseZ, column2.y * inverseZ, column2.z * inverseZ });
+	}
+
+	CIN_MATH_INLINE void CIN_MATH_CALL DecomposeOrthonormal(const Matrix4SoA& matrix, Vector3SoA& translation, QuaternionSoA& rotation) noexcept
+	{
+		const ScalarSoA* const m{ matrix.elements };
+		translation = Vector3SoA{ m[12], m[13], m[14] };
+		rotation = Implementation::DecomposeRotation(Vector3SoA{ m[0], m[1], m[2] }, Vector3SoA{ m[4], m[5], m[6] }, Vector3SoA{ m[8], m[9], m[10] });
+	}
+
+	[[nodiscard]] CIN_MATH_INLINE Matrix4SoA CIN_MATH_CALL Compose(const Vector3SoA& translation, const QuaternionSoA& rotation, const Vector3SoA& scale) noexcept
+	{
+		const ScalarSoA one{ 1.0f };
+		const ScalarSoA two{ 2.0f };
+		const ScalarSoA& w{ rotation.scalar };
+		const ScalarSoA& x{ rotation.vector.x };
+		const ScalarSoA& y{ rotation.vector.y };
+		const ScalarSoA& z{ rotation.vector.z };
+
+		/* Same formulas as Compose(Matrix4) */
+		Matrix4SoA result;
+		ScalarSoA* const r{ result.elements };
+		r[0] = (one - two * (y * y + z * z)) * scale.x;
+		r[1] = two * (x * y + w * z) * scale.x;
+		r[2] = two * (x * z - w * y) * scale.x;
+
+		r[4] = two * (x * y - w * z) * scale.y;
+		r[5] = (one - two * (x * x + z * z)) * scale.y;
+		r[6] = two * (y * z + w * x) * scale.y;
+
+		r[8] = two * (x * z + w * y) * scale.z;
+		r[9] = two * (y * z - w * x) * scale.z;
+		r[10] = (one - two * (x * x + y * y)) * scale.z;
+
+		r[12] = translation.x;
+		r[13] = translation.y;
+		r[14] = translation.z;
+		r[15] = one;
+
+		return result;
+	}
+}
@@ -0,0 +1,291 @@
+#pragma once
+#include <new>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+namespace CinMath {
+	/* Containers must keep the alignment of the register types they wrap, otherwise aligned loads fault */
+	static_assert(alignof(Vector<4, float>) == alignof(Storage<4, float>::Container), "Vector4 must keep the alignment of its container");
+	static_assert(alignof(Vector<2, double>) == alignof(Storage<2, double>::Container), "Vector2 double must keep the alignment of its container");
+	static_assert(alignof(Vector<4, double>) == alignof(Storage<4, double>::Container), "Vector4 double must keep the alignment of its container");
+	static_assert(alignof(Matrix<2, 2, float>) == alignof(MatrixStorage<2, 2, float>::Container), "Matrix2x2 must keep the alignment of its container");
+	static_assert(alignof(Matrix<4, 4, float>) == alignof(MatrixStorage<4, 4, float>::Container), "Matrix4x4 must keep the alignment of its container");
+	static_assert(alignof(Matrix<4, 4, float>) <= SIMDAlignment, "Matrix4x4 alignment exceeds the SIMD alignment");
+
+	/**
+	 * Standard allocator returning memory aligned to max(Alignment, alignof(T)), so arrays of SIMD backed types
+	 * can be accessed with aligned loads and streaming stores
+	 */
+	template<typename T, std::size_t Alignment = SIMDAlignment>
+	class AlignedAllocator
+	{
+	public:
+		static_assert(Alignment != 0U && (Alignment & (Alignment - 1U)) == 0U, "Alignment must be a power of two");
+
+		typedef T value_type;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef std::true_type is_always_equal;
+		typedef std::true_type propagate_on_container_move_assignment;
+
+		static constexpr std::size_t alignment{ Alignment > alignof(T) ? Alignment : alignof(T) };
+
+		template<typename U>
+		struct rebind final
+		{
+			typedef AlignedAllocator<U, Alignment> other;
+		};
+
+		constexpr AlignedAllocator() noexcept = default;
+
+		template<typename U>
+		constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+		{}
+
+		[[nodiscard]] T* allocate(const std::size_t count)
+		{
+			if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+				throw std::bad_array_new_length();
+
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ alignment }));
+		}
+
+		void deallocate(T* const pointer, [[maybe_unused]] const std::size_t count) noexcept
+		{
+			::operator delete(pointer, std::align_val_t{ alignment });
+		}
+
+		template<typename U>
+		constexpr bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+		{
+			return true;
+		}
+	};
+
+	/* Contiguous, growable array whose storage is SIMD aligned */
+	template<typename T, std::size_t Alignment = SIMDAlignment>
+	using Array = std::vector<T, AlignedAllocator<T, Alignment>>;
+
+	/* Checks whether the pointer satisfies the given alignment */
+	template<std::size_t Alignment = SIMDAlignment, typename T>
+	CIN_MATH_INLINE bool IsAligned(const T* const pointer) noexcept
+	{
+		static_assert(Alignment != 0U && (Alignment & (Alignment - 1U)) == 0U, "Alignment must be a power of two");
+		return (reinterpret_cast<std::uintptr_t>(pointer) & (Alignment - 1U)) == 0U;
+	}
+
+	/**
+	 * Linear allocator for transient buffers. Allocation bumps an offset, individual deallocation is a no-op and
+	 * Reset releases everything in O(1), typically once per frame. Storage handed out is uninitialized and
+	 * meant for trivially copyable types (vectors, matrices, quaternions)
+	 */
+	class FrameArena final
+	{
+	public:
+		static constexpr std::size_t DefaultCapacity{ 4U * 1024U * 1024U };
+		static constexpr std::size_t BufferAlignment{ 64U };
+
+		typedef std::size_t Marker;
+
+		explicit FrameArena(const std::size_t capacity = DefaultCapacity)
+			:
+			m_Buffer(static_cast<unsigned char*>(::operator new(capacity, std::align_val_t{ BufferAlignment }))),
+			m_Capacity(capacity),
+			m_Offset(0U)
+		{}
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		FrameArena(FrameArena&& other) noexcept
+			:
+			m_Buffer(std::exchange(other.m_Buffer, nullptr)),
+			m_Capacity(std::exchange(other.m_Capacity, 0U)),
+			m_Offset(std::exchange(other.m_Offset, 0U))
+		{}
+
+		FrameArena& operator=(FrameArena&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Release();
+				m_Buffer = std::exchange(other.m_Buffer, nullptr);
+				m_Capacity = std::exchange(other.m_Capacity, 0U);
+				m_Offset = std::exchange(other.m_Offset, 0U);
+			}
+
+			return *this;
+		}
+
+		~FrameArena() noexcept
+		{
+			Release();
+		}
+
+		/**
+		 * Allocates uninitialized storage
+		 *
+		 * @param size in bytes
+		 * @param alignment power of two, at most BufferAlignment
+		 * @return pointer to the storage, nullptr when the arena is exhausted
+		 */
+		[[nodiscard]] CIN_MATH_INLINE void* Allocate(const std::size_t size, const std::size_t alignment = SIMDAlignment) noexcept
+		{
+			assert(alignment != 0U && (alignment & (alignment - 1U)) == 0U && alignment <= BufferAlignment);
+
+			const std::size_t begin{ (m_Offset + (alignment - 1U)) & ~(alignment - 1U) };
+			if (begin > m_Capacity || size > m_Capacity - begin)
+				return nullptr;
+
+			m_Offset = begin + size;
+			return m_Buffer + begin;
+		}
+
+		/**
+		 * Allocates uninitialized storage for an array, aligned for SIMD access
+		 *
+		 * @param count number of elements
+		 * @return pointer to the first element, nullptr when the arena is exhausted
+		 */
+		template<typename T>
+		[[nodiscard]] CIN_MATH_INLINE T* Allocate(const std::size_t count) noexcept
+		{
+			static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "Arena storage is never destroyed");
+			constexpr std::size_t alignment{ alignof(T) > SIMDAlignment ? alignof(T) : SIMDAlignment };
+
+			if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+				return nullptr;
+
+			return static_cast<T*>(Allocate(count * sizeof(T), alignment));
+		}
+
+		/* Current position, allocations made after it can be released with Rewind */
+		[[nodiscard]] CIN_MATH_INLINE Marker GetMarker() const noexcept
+		{
+			return m_Offset;
+		}
+
+		CIN_MATH_INLINE void Rewind(const Marker marker) noexcept
+		{
+			assert(marker <= m_Offset);
+			m_Offset = marker;
+		}
+
+		/* Releases every allocation */
+		CIN_MATH_INLINE void Reset() noexcept
+		{
+			m_Offset = 0U;
+		}
+
+		[[nodiscard]] CIN_MATH_INLINE std::size_t GetUsed() const noexcept
+		{
+			return m_Offset;
+		}
+
+		[[nodiscard]] CIN_MATH_INLINE std::size_t GetCapacity() const noexcept
+		{
+			return m_Capacity;
+		}
+
+		/* Arena owned by the calling thread, created with the given capacity on first use */
+		[[nodiscard]] static FrameArena& ForCurrentThread(const std::size_t capacity = DefaultCapacity)
+		{
+			thread_local FrameArena s_Arena{ capacity };
+			return s_Arena;
+		}
+	private:
+		void Release() noexcept
+		{
+			if (m_Buffer)
+				::operator delete(m_Buffer, std::align_val_t{ BufferAlignment });
+		}
+	private:
+		unsigned char* m_Buffer;
+		std::size_t m_Capacity;
+		std::size_t m_Offset;
+	};
+
+	/* Rewinds the arena to the position it had on construction */
+	class FrameArenaScope final
+	{
+	public:
+		explicit FrameArenaScope(FrameArena& arena) noexcept
+			:
+			m_Arena(arena),
+			m_Marker(arena.GetMarker())
+		{}
+
+		FrameArenaScope(const FrameArenaScope&) = delete;
+		FrameArenaScope& operator=(const FrameArenaScope&) = delete;
+
+		~FrameArenaScope() noexcept
+		{
+			m_Arena.Rewind(m_Marker);
+		}
+	private:
+		FrameArena& m_Arena;
+		const FrameArena::Marker m_Marker;
+	};
+
+	/* Standard allocator drawing from a FrameArena, lets std containers use frame scratch memory */
+	template<typename T>
+	class ArenaAllocator
+	{
+	public:
+		typedef T value_type;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef std::false_type is_always_equal;
+		typedef std::true_type propagate_on_container_copy_assignment;
+		typedef std::true_type propagate_on_container_move_assignment;
+		typedef std::true_type propagate_on_container_swap;
+
+		explicit ArenaAllocator(FrameArena& arena = FrameArena::ForCurrentThread()) noexcept
+			:
+			m_Arena(&arena)
+		{}
+
+		template<typename U>
+		ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+			:
+			m_Arena(other.GetArena())
+		{}
+
+		[[nodiscard]] T* allocate(const std::size_t count)
+		{
+			constexpr std::size_t alignment{ alignof(T) > SIMDAlignment ? alignof(T) : SIMDAlignment };
+			if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+				throw std::bad_array_new_length();
+
+			void* const storage{ m_Arena->Allocate(count * sizeof(T), alignment) };
+			if (!storage)
+				throw std::bad_alloc();
+
+			return static_cast<T*>(storage);
+		}
+
+		/* Memory is reclaimed by FrameArena::Reset */
+		void deallocate(T* const, const std::size_t) noexcept
+		{}
+
+		[[nodiscard]] FrameArena* GetArena() const noexcept
+		{
+			return m_Arena;
+		}
+
+		template<typename U>
+		bool operator==(const ArenaAllocator<U>& other) const noexcept
+		{
+			return m_Arena == other.GetArena();
+		}
+	private:
+		FrameArena* m_Arena;
+	};
+
+	/* Scratch array living in a frame arena */
+	template<typename T>
+	using FrameArray = std::vector<T, ArenaAllocator<T>>;
+}
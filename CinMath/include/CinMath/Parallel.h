@@ -0,0 +1,341 @@
+#pragma once
+/* Opt-in: multithreaded drivers for the batch API. Include after (or instead of) CinMath.h */
+#include "CinMath.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace CinMath {
+	/**
+	 * Fixed size pool of worker threads. Every worker owns a task queue, pops its own work from the back and
+	 * steals from the front of the other queues when it runs dry
+	 */
+	class ThreadPool final
+	{
+	public:
+		/**
+		 * @param input number of worker threads, 0 runs every task on the submitting thread
+		 * @param input pins worker i to the i-th CPU the process may run on. Neighbouring chunks then stay on
+		 *		  neighbouring cores (and so, usually, on the same NUMA node) instead of migrating
+		 */
+		explicit ThreadPool(const std::size_t threadCount = DefaultThreadCount(), const bool pinThreads = false)
+			:
+			m_Pending(0U),
+			m_NextQueue(0U),
+			m_Stop(false)
+		{
+			m_Queues.reserve(threadCount);
+			for (std::size_t i{ 0U }; i < threadCount; ++i)
+				m_Queues.emplace_back(std::make_unique<WorkerQueue>());
+
+			m_Threads.reserve(threadCount);
+			for (std::size_t i{ 0U }; i < threadCount; ++i)
+			{
+				m_Threads.emplace_back([this, i]() { WorkerLoop(i); });
+				if (pinThreads)
+					PinThread(m_Threads.back(), i);
+			}
+		}
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		~ThreadPool() noexcept
+		{
+			{
+				const std::lock_guard<std::mutex> lock{ m_WakeMutex };
+				m_Stop = true;
+			}
+			m_WakeCondition.notify_all();
+
+			for (std::thread& thread : m_Threads)
+				thread.join();
+		}
+
+		[[nodiscard]] std::size_t GetThreadCount() const noexcept
+		{
+			return m_Threads.size();
+		}
+
+		/* Queues a task, tasks must not throw */
+		void Submit(std::function<void()> task)
+		{
+			if (m_Queues.empty())
+			{
+				task();
+				return;
+			}
+
+			/* Workers keep the work they spawn, other threads spread it round robin */
+			const std::size_t queue{ s_WorkerIndex.pool == this ? s_WorkerIndex.index : m_NextQueue.fetch_add(1U, std::memory_order_relaxed) % m_Queues.size() };
+			{
+				/* Counted before the queue unlocks so a thief can never take an uncounted task */
+				const std::lock_guard<std::mutex> queueLock{ m_Queues[queue]->mutex };
+				m_Queues[queue]->tasks.push_back(std::move(task));
+
+				const std::lock_guard<std::mutex> wakeLock{ m_WakeMutex };
+				++m_Pending;
+			}
+			m_WakeCondition.notify_one();
+		}
+
+		/* Runs one queued task on the calling thread, lets a waiting thread help instead of blocking */
+		bool RunPendingTask()
+		{
+			std::function<void()> task;
+			const std::size_t first{ s_WorkerIndex.pool == this ? s_WorkerIndex.index : 0U };
+			if (!TakeTask(first, task))
+				return false;
+
+			task();
+			return true;
+		}
+
+		[[nodiscard]] static std::size_t DefaultThreadCount() noexcept
+		{
+			const std::size_t hardwareThreads{ std::thread::hardware_concurrency() };
+			/* The thread calling ParallelFor works too */
+			return hardwareThreads > 1U ? hardwareThreads - 1U : 0U;
+		}
+
+		/* Process wide pool, created on first use */
+		[[nodiscard]] static ThreadPool& GetDefault()
+		{
+			static ThreadPool s_Pool{};
+			return s_Pool;
+		}
+	private:
+		struct WorkerQueue final
+		{
+			std::mutex mutex;
+			std::deque<std::function<void()>> tasks;
+		};
+
+		struct WorkerIndex final
+		{
+			const ThreadPool* pool;
+			std::size_t index;
+		};
+
+		bool TakeTask(const std::size_t first, std::function<void()>& task)
+		{
+			/* Own queue from the back (most recently pushed, still in cache) */
+			{
+				WorkerQueue& queue{ *m_Queues[first] };
+				const std::lock_guard<std::mutex> lock{ queue.mutex };
+				if (!queue.tasks.empty())
+				{
+					task = std::move(queue.tasks.back());
+					queue.tasks.pop_back();
+					OnTaken();
+					return true;
+				}
+			}
+
+			/* Steal the oldest task of the others */
+			for (std::size_t offset{ 1U }; offset < m_Queues.size(); ++offset)
+			{
+				WorkerQueue& queue{ *m_Queues[(first + offset) % m_Queues.size()] };
+				const std::lock_guard<std::mutex> lock{ queue.mutex };
+				if (!queue.tasks.empty())
+				{
+					task = std::move(queue.tasks.front());
+					queue.tasks.pop_front();
+					OnTaken();
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		void OnTaken() noexcept
+		{
+			const std::lock_guard<std::mutex> lock{ m_WakeMutex };
+			--m_Pending;
+		}
+
+		void WorkerLoop(const std::size_t index)
+		{
+			s_WorkerIndex = WorkerIndex{ this, index };
+
+			std::function<void()> task;
+			for (;;)
+			{
+				if (TakeTask(index, task))
+				{
+					task();
+					task = nullptr;
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock{ m_WakeMutex };
+				m_WakeCondition.wait(lock, [this]() { return m_Stop || m_Pending != 0U; });
+				if (m_Stop && m_Pending == 0U)
+					return;
+			}
+		}
+
+		static void PinThread([[maybe_unused]] std::thread& thread, [[maybe_unused]] const std::size_t index) noexcept
+		{
+#if defined(__linux__)
+			cpu_set_t allowed;
+			CPU_ZERO(&allowed);
+			if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+				return;
+
+			const int allowedCount{ CPU_COUNT(&allowed) };
+			if (allowedCount == 0)
+				return;
+
+			/* index-th allowed CPU, wrapping around when there are more workers than CPUs */
+			int target{ static_cast<int>(index % static_cast<std::size_t>(allowedCount)) };
+			for (int cpu{ 0 }; cpu < CPU_SETSIZE; ++cpu)
+			{
+				if (!CPU_ISSET(cpu, &allowed) || target-- != 0)
+					continue;
+
+				cpu_set_t pinned;
+				CPU_ZERO(&pinned);
+				CPU_SET(cpu, &pinned);
+				pthread_setaffinity_np(thread.native_handle(), sizeof(pinned), &pinned);
+				return;
+			}
+#endif
+		}
+	private:
+		std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+		std::vector<std::thread> m_Threads;
+
+		std::mutex m_WakeMutex;
+		std::condition_variable m_WakeCondition;
+		std::size_t m_Pending;
+		std::atomic<std::size_t> m_NextQueue;
+		bool m_Stop;
+
+		static inline thread_local WorkerIndex s_WorkerIndex{ nullptr, 0U };
+	};
+
+	/* Chunks are sized so their working set stays within a typical per-core L2 */
+	constexpr std::size_t ParallelChunkBytes{ 128U * 1024U };
+
+	/**
+	 * Number of elements per chunk keeping the chunk working set within ParallelChunkBytes
+	 *
+	 * @param input bytes read and written per element
+	 * @return elements per chunk, at least one
+	 */
+	constexpr CIN_MATH_INLINE std::size_t ParallelChunkSize(const std::size_t bytesPerElement) noexcept
+	{
+		return bytesPerElement == 0U || bytesPerElement >= ParallelChunkBytes ? 1U : ParallelChunkBytes / bytesPerElement;
+	}
+
+	/**
+	 * Splits [0, count) into chunks and runs function(begin, end) for each of them on the pool. The calling
+	 * thread processes chunks as well and returns once every chunk is done
+	 *
+	 * @param input pool
+	 * @param input number of elements
+	 * @param input elements per chunk
+	 * @param input callable taking (std::size_t begin, std::size_t end), must not throw
+	 */
+	template<typename Function>
+	void ParallelFor(ThreadPool& pool, const std::size_t count, std::size_t chunkSize, Function&& function)
+	{
+		if (count == 0U)
+			return;
+
+		chunkSize = chunkSize == 0U ? 1U : chunkSize;
+		const std::size_t chunkCount{ (count + chunkSize - 1U) / chunkSize };
+		if (chunkCount == 1U || pool.GetThreadCount() == 0U)
+		{
+			function(std::size_t{ 0U }, count);
+			return;
+		}
+
+		std::atomic<std::size_t> remaining{ chunkCount - 1U };
+		for (std::size_t chunk{ 1U }; chunk < chunkCount; ++chunk)
+		{
+			const std::size_t begin{ chunk * chunkSize };
+			const std::size_t end{ begin + chunkSize < count ? begin + chunkSize : count };
+			pool.Submit([&function, &remaining, begin, end]()
+			{
+				function(begin, end);
+				remaining.fetch_sub(1U, std::memory_order_release);
+			});
+		}
+
+		function(std::size_t{ 0U }, chunkSize);
+
+		/* Help with the remaining chunks rather than sleeping */
+		while (remaining.load(std::memory_order_acquire) != 0U)
+			if (!pool.RunPendingTask())
+				std::this_thread::yield();
+	}
+
+	namespace Parallel {
+		/* Multithreaded MultiplyArray */
+		template<typename ValueType>
+		void MultiplyArray(ThreadPool& pool, const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT lhs, const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT rhs, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT result, const std::size_t count)
+		{
+			ParallelFor(pool, count, ParallelChunkSize(3U * sizeof(Matrix<4, 4, ValueType>)), [=](const std::size_t begin, const std::size_t end) noexcept
+			{
+				CinMath::MultiplyArray(lhs + begin, rhs + begin, result + begin, end - begin);
+			});
+		}
+
+		/* Multithreaded MultiplyArray */
+		template<typename ValueType>
+		void MultiplyArray(ThreadPool& pool, const Matrix<4, 4, ValueType>& lhs, const Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT rhs, Matrix<4, 4, ValueType>* CIN_MATH_RESTRICT result, const std::size_t count)
+		{
+			ParallelFor(pool, count, ParallelChunkSize(2U * sizeof(Matrix<4, 4, ValueType>)), [&lhs, rhs, result](const std::size_t begin, const std::size_t end) noexcept
+			{
+				CinMath::MultiplyArray(lhs, rhs + begin, result + begin, end - begin);
+			});
+		}
+
+		/* Multithreaded TransformPoints */
+		template<typename ValueType>
+		void TransformPoints(ThreadPool& pool, const Matrix<4, 4, ValueType>& matrix, const Vector<4, ValueType>* CIN_MATH_RESTRICT input, Vector<4, ValueType>* CIN_MATH_RESTRICT output, const std::size_t count)
+		{
+			ParallelFor(pool, count, ParallelChunkSize(2U * sizeof(Vector<4, ValueType>)), [&matrix, input, output](const std::size_t begin, const std::size_t end) noexcept
+			{
+				CinMath::TransformPoints(matrix, input + begin, output + begin, end - begin);
+			});
+		}
+
+		/* Multithreaded RotateArray */
+		template<typename ValueType>
+		void RotateArray(ThreadPool& pool, const TQuaternion<ValueType>& rotation, const Vector<3, ValueType>* CIN_MATH_RESTRICT input, Vector<3, ValueType>* CIN_MATH_RESTRICT output, const std::size_t count)
+		{
+			ParallelFor(pool, count, ParallelChunkSize(2U * sizeof(Vector<3, ValueType>)), [&rotation, input, output](const std::size_t begin, const std::size_t end) noexcept
+			{
+				CinMath::RotateArray(rotation, input + begin, output + begin, end - begin);
+			});
+		}
+
+		/* Multithreaded CullSpheres */
+		template<typename ValueType>
+		std::size_t CullSpheres(ThreadPool& pool, const std::array<Vector<4, ValueType>, 6>& planes, const Vector<4, ValueType>* CIN_MATH_RESTRICT spheres, std::uint8_t* CIN_MATH_RESTRICT visibility, const std::size_t count)
+		{
+			std::atomic<std::size_t> visible{ 0U };
+			ParallelFor(pool, count, ParallelChunkSize(sizeof(Vector<4, ValueType>) + sizeof(std::uint8_t)), [&planes, &visible, spheres, visibility](const std::size_t begin, const std::size_t end) noexcept
+			{
+				visible.fetch_add(CinMath::CullSpheres(planes, spheres + begin, visibility + begin, end - begin), std::memory_order_relaxed);
+			});
+
+			return visible.load(std::memory_order_relaxed);
+		}
+	}
+}
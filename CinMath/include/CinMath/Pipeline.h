@@ -0,0 +1,363 @@
+#pragma once
+/* Opt-in: fused batch pipelines, Transform(matrix) | Normalize() | BoundsReduce(). Include after (or instead of) CinMath.h */
+#include "Parallel.h"
+
+#include <concepts>
+#include <iterator>
+#include <tuple>
+
+namespace CinMath {
+	namespace Pipeline {
+		/*
+		 * A pipeline is a chain of element stages, optionally ended by one reduction. Running it makes a single
+		 * pass over the input: each element is loaded once, taken through every stage in registers and handed to
+		 * the reduction, so a chain of N stages costs one trip through memory instead of N. The stages are plain
+		 * calls into the SIMD operators of the element type (Matrix4 * Vector4, Normalize, Min/Max, ...), inlined
+		 * into the loop. The multithreaded Run splits the input into cache sized chunks, reduces each chunk on
+		 * its own and combines the partial results in chunk order, so the result does not depend on the schedule
+		 */
+
+		/* Element stage, function(element, index) returns the new element */
+		template<typename Function>
+		struct Stage final
+		{
+			Function Apply;
+		};
+
+		/* Terminal stage, Identity(std::type_identity<Element>) gives the initial result for the element type */
+		template<typename Initial, typename Accumulate, typename Combine>
+		struct Reduction final
+		{
+			Initial Identity;
+			Accumulate Fold;
+			Combine Merge;
+		};
+
+		template<typename T>
+		struct IsReduction final : std::false_type
+		{};
+
+		template<typename Initial, typename Accumulate, typename Combine>
+		struct IsReduction<Reduction<Initial, Accumulate, Combine>> final : std::true_type
+		{};
+
+		template<typename T>
+		struct IsStage final : std::false_type
+		{};
+
+		template<typename Function>
+		struct IsStage<Stage<Function>> final : std::true_type
+		{};
+
+		/* Stages in order, the last one may be a reduction */
+		template<typename... Parts>
+		struct Chain final
+		{
+			std::tuple<Parts...> Stages;
+		};
+
+		template<typename T>
+		struct IsChain final : std::false_type
+		{};
+
+		template<typename... Parts>
+		struct IsChain<Chain<Parts...>> final : std::true_type
+		{};
+
+		template<typename T>
+		concept PipelinePart = IsStage<T>::value || IsReduction<T>::value || IsChain<T>::value;
+
+		namespace Implementation {
+			template<typename T>
+			constexpr Chain<T> AsChain(const T& stage) noexcept
+			{
+				return Chain<T>{ std::tuple<T>{ stage } };
+			}
+
+			template<typename... Parts>
+			constexpr const Chain<Parts...>& AsChain(const Chain<Parts...>& chain) noexcept
+			{
+				return chain;
+			}
+
+			template<typename... Lhs, typename... Rhs>
+			constexpr Chain<Lhs..., Rhs...> Concatenate(const Chain<Lhs...>& lhs, const Chain<Rhs...>& rhs) noexcept
+			{
+				static_assert((!IsReduction<Lhs>::value && ...), "A reduction must be the last stage of a pipeline");
+				return Chain<Lhs..., Rhs...>{ std::tuple_cat(lhs.Stages, rhs.Stages) };
+			}
+
+			template<typename... Parts>
+			constexpr bool HasReduction() noexcept
+			{
+				if constexpr (sizeof...(Parts) == 0U)
+					return false;
+				else
+					return IsReduction<std::tuple_element_t<sizeof...(Parts) - 1U, std::tuple<Parts...>>>::value;
+			}
+
+			/* Runs the element stages First..Last-1 on one element */
+			template<std::size_t Index, std::size_t Last, typename Tuple, typename Element>
+			CIN_MATH_INLINE auto ApplyStages(const Tuple& stages, const Element& element, const std::size_t index) noexcept
+			{
+				if constexpr (Index == Last)
+					return element;
+				else
+					return ApplyStages<Index + 1U, Last>(stages, std::get<Index>(stages).Apply(element, index), index);
+			}
+
+			/* Element type reaching the reduction */
+			template<typename Element, typename... Parts>
+			using ReducedElement = std::remove_cvref_t<decltype(ApplyStages<0U, sizeof...(Parts) - 1U>(std::declval<const std::tuple<Parts...>&>(), std::declval<const Element&>(), std::size_t{}))>;
+
+			/* Component-wise minimum of any vector, the SIMD Min where the element type has one. Like Min, rhs is kept on NaN */
+			template<typename Element>
+			CIN_MATH_INLINE Element ComponentMin(const Element& lhs, const Element& rhs) noexcept
+			{
+				if constexpr (requires { { Min(lhs, rhs) } -> std::same_as<Element>; })
+					return Min(lhs, rhs);
+				else
+				{
+					Element result{ rhs };
+					for (std::size_t i{ 0U }; i < std::size(lhs.raw); ++i)
+						result.raw[i] = lhs.raw[i] < rhs.raw[i] ? lhs.raw[i] : rhs.raw[i];
+
+					return result;
+				}
+			}
+
+			template<typename Element>
+			CIN_MATH_INLINE Element ComponentMax(const Element& lhs, const Element& rhs) noexcept
+			{
+				if constexpr (requires { { Max(lhs, rhs) } -> std::same_as<Element>; })
+					return Max(lhs, rhs);
+				else
+				{
+					Element result{ rhs };
+					for (std::size_t i{ 0U }; i < std::size(lhs.raw); ++i)
+						result.raw[i] = lhs.raw[i] > rhs.raw[i] ? lhs.raw[i] : rhs.raw[i];
+
+					return result;
+				}
+			}
+
+			template<typename Element, typename... Parts>
+			CIN_MATH_INLINE auto Identity(const Chain<Parts...>& chain) noexcept
+			{
+				return std::get<sizeof...(Parts) - 1U>(chain.Stages).Identity(std::type_identity<ReducedElement<Element, Parts...>>{});
+			}
+
+			/* Takes [begin, end) through the chain, returns the partial reduction when the chain has one */
+			template<typename Element, typename... Parts>
+			CIN_MATH_INLINE auto RunRange(const Chain<Parts...>& chain, const Element* CIN_MATH_RESTRICT input, const std::size_t begin, const std::size_t end) noexcept
+			{
+				if constexpr (HasReduction<Parts...>())
+				{
+					constexpr std::size_t last{ sizeof...(Parts) - 1U };
+					const auto& reduction{ std::get<last>(chain.Stages) };
+
+					auto result{ Identity<Element>(chain) };
+					for (std::size_t i{ begin }; i < end; ++i)
+						result = reduction.Fold(result, ApplyStages<0U, last>(chain.Stages, input[i], i));
+
+					return result;
+				}
+				else
+				{
+					for (std::size_t i{ begin }; i < end; ++i)
+						static_cast<void>(ApplyStages<0U, sizeof...(Parts)>(chain.Stages, input[i], i));
+				}
+			}
+		}
+
+		/* Chains two stages, a stage and a chain or two chains */
+		template<PipelinePart Lhs, PipelinePart Rhs>
+		constexpr auto operator|(const Lhs& lhs, const Rhs& rhs) noexcept
+		{
+			return Implementation::Concatenate(Implementation::AsChain(lhs), Implementation::AsChain(rhs));
+		}
+
+		/**
+		 * Any element function
+		 *
+		 * @param input callable taking the element (and optionally its index) and returning the new element
+		 * @return stage
+		 */
+		template<typename Function>
+		constexpr auto Map(Function function) noexcept
+		{
+			return Stage{ [function](const auto& element, [[maybe_unused]] const std::size_t index) noexcept
+			{
+				if constexpr (std::is_invocable_v<const Function&, decltype(element), std::size_t>)
+					return function(element, index);
+				else
+					return function(element);
+			} };
+		}
+
+		/**
+		 * Multiplies every element by a matrix, matrix * element
+		 *
+		 * @param input transformation matrix, copied into the stage
+		 * @return stage
+		 */
+		template<typename ValueType>
+		constexpr auto Transform(const Matrix<4, 4, ValueType>& matrix) noexcept
+		{
+			return Stage{ [matrix](const auto& element, std::size_t) noexcept
+			{
+				return matrix * element;
+			} };
+		}
+
+		/* Normalizes every element */
+		constexpr auto Normalize() noexcept
+		{
+			return Stage{ [](const auto& element, std::size_t) noexcept
+			{
+				return CinMath::Normalize(element);
+			} };
+		}
+
+		/* Normalizes every element with NormalizeFast */
+		constexpr auto NormalizeFast() noexcept
+		{
+			return Stage{ [](const auto& element, std::size_t) noexcept
+			{
+				return CinMath::NormalizeFast(element);
+			} };
+		}
+
+		/**
+		 * Writes every element to output[index] and passes it on, to keep an intermediate (or the final) result
+		 *
+		 * @param output array of at least count elements, must not alias the input
+		 * @return stage
+		 */
+		template<typename Element>
+		constexpr auto Store(Element* const output) noexcept
+		{
+			return Stage{ [output](const Element& element, const std::size_t index) noexcept
+			{
+				output[index] = element;
+				return element;
+			} };
+		}
+
+		/* Component-wise minimum and maximum of the elements */
+		template<typename Element>
+		struct Bounds final
+		{
+			Element Minimum;
+			Element Maximum;
+		};
+
+		/**
+		 * Component-wise bounds (Bounds<Element>) of the elements, any vector length. An empty input gives Minimum = +max
+		 * and Maximum = -max
+		 *
+		 * @return reduction
+		 */
+		constexpr auto BoundsReduce() noexcept
+		{
+			const auto merge{ []<typename Element>(const Bounds<Element>& lhs, const Bounds<Element>& rhs) noexcept
+			{
+				return Bounds<Element>{ Implementation::ComponentMin(lhs.Minimum, rhs.Minimum), Implementation::ComponentMax(lhs.Maximum, rhs.Maximum) };
+			} };
+
+			return Reduction
+			{
+				[]<typename Element>(std::type_identity<Element>) noexcept
+				{
+					typedef std::remove_cvref_t<decltype(std::declval<const Element&>().raw[0])> ValueType;
+					return Bounds<Element>{ Element{ std::numeric_limits<ValueType>::max() }, Element{ -std::numeric_limits<ValueType>::max() } };
+				},
+				[]<typename Element>(const Bounds<Element>& bounds, const Element& element) noexcept
+				{
+					return Bounds<Element>{ Implementation::ComponentMin(bounds.Minimum, element), Implementation::ComponentMax(bounds.Maximum, element) };
+				},
+				merge
+			};
+		}
+
+		/**
+		 * Sum of the elements
+		 *
+		 * @return reduction
+		 */
+		constexpr auto SumReduce() noexcept
+		{
+			const auto add{ [](const auto& lhs, const auto& rhs) noexcept
+			{
+				return lhs + rhs;
+			} };
+
+			return Reduction
+			{
+				[]<typename Element>(std::type_identity<Element>) noexcept
+				{
+					return Element{ 0 };
+				},
+				add,
+				add
+			};
+		}
+
+		/**
+		 * Runs a pipeline over an array on the calling thread
+		 *
+		 * @param input pipeline
+		 * @param input elements
+		 * @param input number of elements
+		 * @return result of the reduction, nothing when the pipeline has none
+		 */
+		template<PipelinePart Pipeline, typename Element>
+		CIN_MATH_INLINE auto Run(const Pipeline& pipeline, const Element* input, const std::size_t count) noexcept
+		{
+			return Implementation::RunRange(Implementation::AsChain(pipeline), input, std::size_t{ 0U }, count);
+		}
+
+		/**
+		 * Runs a pipeline over an array on a thread pool, chunk by chunk
+		 *
+		 * @param input pool
+		 * @param input pipeline
+		 * @param input elements
+		 * @param input number of elements
+		 * @return result of the reduction, nothing when the pipeline has none
+		 */
+		template<PipelinePart Pipeline, typename Element>
+		auto Run(ThreadPool& pool, const Pipeline& pipeline, const Element* input, const std::size_t count)
+		{
+			const auto& chain{ Implementation::AsChain(pipeline) };
+			/* Input and (when stored) output of every element stay in cache for the whole chunk */
+			const std::size_t chunkSize{ ParallelChunkSize(2U * sizeof(Element)) };
+
+			if constexpr (std::is_void_v<decltype(Implementation::RunRange(chain, input, 0U, 0U))>)
+			{
+				ParallelFor(pool, count, chunkSize, [&chain, input](const std::size_t begin, const std::size_t end) noexcept
+				{
+					Implementation::RunRange(chain, input, begin, end);
+				});
+			}
+			else
+			{
+				typedef decltype(Implementation::RunRange(chain, input, 0U, 0U)) Result;
+				const auto& reduction{ std::get<std::tuple_size_v<decltype(chain.Stages)> - 1U>(chain.Stages) };
+				const Result identity{ Implementation::Identity<Element>(chain) };
+
+				std::vector<Result> partials((count + chunkSize - 1U) / chunkSize, identity);
+				ParallelFor(pool, count, chunkSize, [&chain, &partials, input, chunkSize](const std::size_t begin, const std::size_t end) noexcept
+				{
+					partials[begin / chunkSize] = Implementation::RunRange(chain, input, begin, end);
+				});
+
+				Result result{ identity };
+				for (const Result& partial : partials)
+					result = reduction.Merge(result, partial);
+
+				return result;
+			}
+		}
+	}
+}
@@ -0,0 +1,314 @@
+#pragma once
+
+/*
+ * Profiling hooks of the batch kernels, compiled out unless CIN_MATH_PROFILE is defined before including CinMath.h.
+ * Every call of an instrumented kernel adds one call, its element count and the elapsed time stamp counter ticks
+ * (rdtsc, reference cycles; a steady clock in nanoseconds where there is none) to counters owned by the calling
+ * thread, so kernels never contend. ProfileCapture sums the counters of all threads (live and finished),
+ * ProfileDump prints them and ProfileWriteChromeTrace exports the individual calls recorded while
+ * ProfileSetTracing(true) as a chrome://tracing / Perfetto JSON file. Without CIN_MATH_PROFILE nothing of this
+ * exists and CIN_MATH_PROFILE_SCOPE expands to nothing
+ */
+#ifdef CIN_MATH_PROFILE
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace CinMath {
+	/* Instrumented kernels */
+	enum class ProfileKernel : std::uint32_t
+	{
+		MultiplyArray = 0U,
+		TransformPoints = 1U,
+		RotateArray = 2U,
+		NormalizeArray = 3U,
+		CullSpheres = 4U,
+		MultiplyChain = 5U,
+		DecomposeArray = 6U,
+		Count = 7U
+	};
+
+	constexpr std::string_view ProfileKernelName(const ProfileKernel kernel) noexcept
+	{
+		constexpr std::array<std::string_view, static_cast<std::size_t>(ProfileKernel::Count)> names
+		{
+			"MultiplyArray", "TransformPoints", "RotateArray", "NormalizeArray", "CullSpheres", "MultiplyChain", "DecomposeArray"
+		};
+
+		return names[static_cast<std::size_t>(kernel)];
+	}
+
+	struct ProfileCounters final
+	{
+		std::uint64_t Calls;
+		std::uint64_t Elements;
+		/* Time stamp counter ticks */
+		std::uint64_t Cycles;
+	};
+
+	/* Counters of every kernel, indexed by ProfileKernel */
+	struct ProfileSnapshot final
+	{
+		std::array<ProfileCounters, static_cast<std::size_t>(ProfileKernel::Count)> Kernels;
+
+		constexpr const ProfileCounters& operator[](const ProfileKernel kernel) const noexcept
+		{
+			return Kernels[static_cast<std::size_t>(kernel)];
+		}
+	};
+
+	namespace Implementation {
+		CIN_MATH_INLINE std::uint64_t ProfileTimestamp() noexcept
+		{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+#else
+			return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+		}
+
+		struct ProfileEvent final
+		{
+			ProfileKernel Kernel;
+			std::uint64_t Begin;
+			std::uint64_t Cycles;
+			std::uint64_t Elements;
+		};
+
+		struct ThreadProfile;
+
+		struct ProfileRegistry final
+		{
+			std::mutex Mutex;
+			std::vector<ThreadProfile*> Threads;
+			/* Counters and events of the threads that already exited */
+			ProfileSnapshot Retired{};
+			std::vector<std::pair<std::uint32_t, ProfileEvent>> RetiredEvents;
+			std::uint32_t NextThread{ 0U };
+			std::atomic<bool> Tracing{ false };
+			/* Reference point converting time stamps to microseconds in the trace */
+			const std::uint64_t StartTicks{ ProfileTimestamp() };
+			const std::chrono::steady_clock::time_point StartTime{ std::chrono::steady_clock::now() };
+		};
+
+		inline ProfileRegistry& GetProfileRegistry() noexcept
+		{
+			/*
+			 * Never destroyed: a static ThreadPool constructed before the first profiled call is destroyed after the
+			 * registry, and its workers still retire their ThreadProfile into it at exit
+			 */
+			static ProfileRegistry& registry{ *new ProfileRegistry };
+			return registry;
+		}
+
+		/* Written only by the owning thread, read by ProfileCapture, hence relaxed atomics instead of locks */
+		struct ThreadProfile final
+		{
+			std::array<std::array<std::atomic<std::uint64_t>, 3U>, static_cast<std::size_t>(ProfileKernel::Count)> Counters{};
+			std::mutex EventsMutex;
+			std::vector<ProfileEvent> Events;
+			std::uint32_t Thread;
+
+			ThreadProfile()
+			{
+				ProfileRegistry& registry{ GetProfileRegistry() };
+				const std::lock_guard lock{ registry.Mutex };
+				Thread = registry.NextThread++;
+				registry.Threads.push_back(this);
+			}
+
+			~ThreadProfile()
+			{
+				ProfileRegistry& registry{ GetProfileRegistry() };
+				const std::lock_guard lock{ registry.Mutex };
+				for (std::size_t kernel{ 0U }; kernel < Counters.size(); ++kernel)
+				{
+					registry.Retired.Kernels[kernel].Calls += Counters[kernel][0].load(std::memory_order_relaxed);
+					registry.Retired.Kernels[kernel].Elements += Counters[kernel][1].load(std::memory_order_relaxed);
+					registry.Retired.Kernels[kernel].Cycles += Counters[kernel][2].load(std::memory_order_relaxed);
+				}
+
+				for (const ProfileEvent& event : Events)
+					registry.RetiredEvents.emplace_back(Thread, event);
+
+				std::erase(registry.Threads, this);
+			}
+
+			ThreadProfile(const ThreadProfile&) = delete;
+			ThreadProfile& operator=(const ThreadProfile&) = delete;
+
+			CIN_MATH_INLINE void Add(const ProfileKernel kernel, const std::uint64_t begin, const std::uint64_t cycles, const std::uint64_t elements)
+			{
+				auto& counters{ Counters[static_cast<std::size_t>(kernel)] };
+				counters[0].store(counters[0].load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+				counters[1].store(counters[1].load(std::memory_order_relaxed) + elements, std::memory_order_relaxed);
+				counters[2].store(counters[2].load(std::memory_order_relaxed) + cycles, std::memory_order_relaxed);
+
+				if (GetProfileRegistry().Tracing.load(std::memory_order_relaxed))
+				{
+					const std::lock_guard lock{ EventsMutex };
+					Events.push_back(ProfileEvent{ kernel, begin, cycles, elements });
+				}
+			}
+		};
+
+		inline ThreadProfile& GetThreadProfile()
+		{
+			thread_local ThreadProfile profile;
+			return profile;
+		}
+	}
+
+	/* Times the enclosing scope as one call of a kernel, used through CIN_MATH_PROFILE_SCOPE */
+	class ProfileScope final
+	{
+	public:
+		CIN_MATH_INLINE ProfileScope(const ProfileKernel kernel, const std::size_t elements) noexcept
+			:
+			Kernel{ kernel },
+			Elements{ elements },
+			Begin{ Implementation::ProfileTimestamp() }
+		{}
+
+		/* Profiling builds accept that recording a trace event may allocate, a failure there terminates */
+		CIN_MATH_INLINE ~ProfileScope() noexcept
+		{
+			const std::uint64_t end{ Implementation::ProfileTimestamp() };
+			Implementation::GetThreadProfile().Add(Kernel, Begin, end - Begin, Elements);
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+	private:
+		ProfileKernel Kernel;
+		std::size_t Elements;
+		std::uint64_t Begin;
+	};
+
+	/**
+	 * Sums the counters of all threads, a thread running a kernel meanwhile may or may not be included
+	 *
+	 * @return counters of every kernel since the start (or the last ProfileReset)
+	 */
+	inline ProfileSnapshot ProfileCapture()
+	{
+		Implementation::ProfileRegistry& registry{ Implementation::GetProfileRegistry() };
+		const std::lock_guard lock{ registry.Mutex };
+
+		ProfileSnapshot snapshot{ registry.Retired };
+		for (const Implementation::ThreadProfile* thread : registry.Threads)
+		{
+			for (std::size_t kernel{ 0U }; kernel < snapshot.Kernels.size(); ++kernel)
+			{
+				snapshot.Kernels[kernel].Calls += thread->Counters[kernel][0].load(std::memory_order_relaxed);
+				snapshot.Kernels[kernel].Elements += thread->Counters[kernel][1].load(std::memory_order_relaxed);
+				snapshot.Kernels[kernel].Cycles += thread->Counters[kernel][2].load(std::memory_order_relaxed);
+			}
+		}
+
+		return snapshot;
+	}
+
+	/* Clears the counters and the recorded trace events, call it while no kernel is running */
+	inline void ProfileReset()
+	{
+		Implementation::ProfileRegistry& registry{ Implementation::GetProfileRegistry() };
+		const std::lock_guard lock{ registry.Mutex };
+
+		registry.Retired = ProfileSnapshot{};
+		registry.RetiredEvents.clear();
+		for (Implementation::ThreadProfile* thread : registry.Threads)
+		{
+			for (auto& counters : thread->Counters)
+			{
+				for (std::atomic<std::uint64_t>& counter : counters)
+					counter.store(0U, std::memory_order_relaxed);
+			}
+
+			const std::lock_guard eventsLock{ thread->EventsMutex };
+			thread->Events.clear();
+		}
+	}
+
+	/**
+	 * Records every kernel call from now on for ProfileWriteChromeTrace, off by default. Each call stores
+	 * one event, enable it for the frames of interest only
+	 *
+	 * @param input true to record, false to stop
+	 */
+	inline void ProfileSetTracing(const bool enabled) noexcept
+	{
+		Implementation::GetProfileRegistry().Tracing.store(enabled, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Prints one line per called kernel: calls, elements, cycles and cycles per element
+	 *
+	 * @param output stream
+	 * @param input snapshot
+	 */
+	inline void ProfileDump(std::ostream& stream, const ProfileSnapshot& snapshot)
+	{
+		stream << "kernel,calls,elements,cycles,cycles per element\n";
+		for (std::size_t kernel{ 0U }; kernel < snapshot.Kernels.size(); ++kernel)
+		{
+			const ProfileCounters& counters{ snapshot.Kernels[kernel] };
+			if (counters.Calls == 0U)
+				continue;
+
+			stream << ProfileKernelName(static_cast<ProfileKernel>(kernel)) << ',' << counters.Calls << ',' << counters.Elements << ',' << counters.Cycles << ','
+				<< (counters.Elements != 0U ? static_cast<double>(counters.Cycles) / static_cast<double>(counters.Elements) : 0.0) << '\n';
+		}
+	}
+
+	/**
+	 * Writes the recorded kernel calls in the Chrome trace event format (one complete event per call, one track per thread)
+	 *
+	 * @param output stream
+	 */
+	inline void ProfileWriteChromeTrace(std::ostream& stream)
+	{
+		Implementation::ProfileRegistry& registry{ Implementation::GetProfileRegistry() };
+		const std::lock_guard lock{ registry.Mutex };
+
+		/* Time stamp counter ticks per microsecond, measured over the lifetime of the registry */
+		const std::uint64_t ticks{ Implementation::ProfileTimestamp() - registry.StartTicks };
+		const double microseconds{ std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - registry.StartTime).count() };
+		const double ticksPerMicrosecond{ microseconds > 0.0 && ticks != 0U ? static_cast<double>(ticks) / microseconds : 1.0 };
+
+		bool first{ true };
+		const auto write{ [&](const std::uint32_t thread, const Implementation::ProfileEvent& event)
+		{
+			stream << (first ? "\n" : ",\n") << "{\"name\":\"" << ProfileKernelName(event.Kernel) << "\",\"cat\":\"CinMath\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread
+				<< ",\"ts\":" << static_cast<double>(static_cast<std::int64_t>(event.Begin - registry.StartTicks)) / ticksPerMicrosecond
+				<< ",\"dur\":" << static_cast<double>(event.Cycles) / ticksPerMicrosecond
+				<< ",\"args\":{\"elements\":" << event.Elements << ",\"cycles\":" << event.Cycles << "}}";
+			first = false;
+		} };
+
+		stream << "{\"traceEvents\":[";
+		for (const auto& [thread, event] : registry.RetiredEvents)
+			write(thread, event);
+
+		for (Implementation::ThreadProfile* thread : registry.Threads)
+		{
+			const std::lock_guard eventsLock{ thread->EventsMutex };
+			for (const Implementation::ProfileEvent& event : thread->Events)
+				write(thread->Thread, event);
+		}
+
+		stream << "\n]}\n";
+	}
+}
+
+#define CIN_MATH_PROFILE_SCOPE(kernel, elements) const ::CinMath::ProfileScope cinMathProfileScope{ kernel, elements }
+#else
+#define CIN_MATH_PROFILE_SCOPE(kernel, elements)
+#endif
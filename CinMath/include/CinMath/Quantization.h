@@ -0,0 +1,136 @@
+#pragma once
+
+namespace CinMath {
+	/**
+	 * Unit quaternion in 32 bits, smallest-three encoding: the index of the largest component (2 bits) and the other
+	 * three components (10 bits each) in [-1 / sqrt(2), 1 / sqrt(2)]. The largest component is rebuilt from the unit
+	 * length, its sign is made positive which selects q or -q (the same rotation). Error is below 3e-3 per component
+	 */
+	struct PackedQuaternion32 final
+	{
+		std::uint32_t Bits;
+	};
+
+	/**
+	 * Unit quaternion in 48 bits, smallest-three encoding with 15 bits per stored component (one spare bit).
+	 * Error is below 1e-4 per component
+	 */
+	struct PackedQuaternion48 final
+	{
+		std::uint16_t Bits[3];
+	};
+
+	/**
+	 * Unit vector in 32 bits, octahedral encoding with 16 bits per coordinate. The sphere is projected onto an
+	 * octahedron which is unfolded onto a square, so the precision is close to uniform over all directions
+	 */
+	struct PackedNormal32 final
+	{
+		std::uint16_t X;
+		std::uint16_t Y;
+	};
+
+	static_assert(sizeof(PackedQuaternion32) == 4U && sizeof(PackedQuaternion48) == 6U && sizeof(PackedNormal32) == 4U, "Packed types must stay tightly packed");
+
+	/**
+	 * Encodes a unit quaternion in 32 bits
+	 *
+	 * @param quaternion unit quaternion
+	 * @return packed quaternion
+	 */
+	CIN_MATH_INLINE PackedQuaternion32 PackQuaternion32(const TQuaternion<float>& quaternion) noexcept;
+
+	/**
+	 * Encodes a unit quaternion in 48 bits
+	 *
+	 * @param quaternion unit quaternion
+	 * @return packed quaternion
+	 */
+	CIN_MATH_INLINE PackedQuaternion48 PackQuaternion48(const TQuaternion<float>& quaternion) noexcept;
+
+	/**
+	 * Encodes a unit vector in 32 bits
+	 *
+	 * @param vector unit vector
+	 * @return packed vector
+	 */
+	CIN_MATH_INLINE PackedNormal32 PackNormal32(const Vector<3, float>& vector) noexcept;
+
+	/**
+	 * Decodes a packed quaternion
+	 *
+	 * @param packed packed quaternion
+	 * @return unit quaternion, q or -q of the encoded one
+	 */
+	CIN_MATH_INLINE TQuaternion<float> Unpack(const PackedQuaternion32 packed) noexcept;
+
+	/**
+	 * Decodes a packed quaternion
+	 *
+	 * @param packed packed quaternion
+	 * @return unit quaternion, q or -q of the encoded one
+	 */
+	CIN_MATH_INLINE TQuaternion<float> Unpack(const PackedQuaternion48 packed) noexcept;
+
+	/**
+	 * Decodes a packed unit vector
+	 *
+	 * @param packed packed vector
+	 * @return unit vector
+	 */
+	CIN_MATH_INLINE Vector<3, float> Unpack(const PackedNormal32 packed) noexcept;
+
+	/**
+	 * Encodes unit quaternions, output[i] = PackQuaternion32(input[i]) bit for bit
+	 *
+	 * @param input unit quaternions
+	 * @param output packed quaternions
+	 * @param count number of quaternions
+	 */
+	CIN_MATH_INLINE void PackArray(const TQuaternion<float>* CIN_MATH_RESTRICT input, PackedQuaternion32* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Encodes unit quaternions, output[i] = PackQuaternion48(input[i]) bit for bit
+	 *
+	 * @param input unit quaternions
+	 * @param output packed quaternions
+	 * @param count number of quaternions
+	 */
+	CIN_MATH_INLINE void PackArray(const TQuaternion<float>* CIN_MATH_RESTRICT input, PackedQuaternion48* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Encodes unit vectors, output[i] = PackNormal32(input[i]) bit for bit
+	 *
+	 * @param input unit vectors
+	 * @param output packed vectors
+	 * @param count number of vectors
+	 */
+	CIN_MATH_INLINE void PackArray(const Vector<3, float>* CIN_MATH_RESTRICT input, PackedNormal32* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Decodes packed quaternions, output[i] = Unpack(input[i]) bit for bit
+	 *
+	 * @param input packed quaternions
+	 * @param output unit quaternions
+	 * @param count number of quaternions
+	 */
+	CIN_MATH_INLINE void UnpackArray(const PackedQuaternion32* CIN_MATH_RESTRICT input, TQuaternion<float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Decodes packed quaternions, output[i] = Unpack(input[i]) bit for bit
+	 *
+	 * @param input packed quaternions
+	 * @param output unit quaternions
+	 * @param count number of quaternions
+	 */
+	CIN_MATH_INLINE void UnpackArray(const PackedQuaternion48* CIN_MATH_RESTRICT input, TQuaternion<float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+
+	/**
+	 * Decodes packed unit vectors, output[i] = Unpack(input[i]) bit for bit
+	 *
+	 * @param input packed vectors
+	 * @param output unit vectors
+	 * @param count number of vectors
+	 */
+	CIN_MATH_INLINE void UnpackArray(const PackedNormal32* CIN_MATH_RESTRICT input, Vector<3, float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept;
+}
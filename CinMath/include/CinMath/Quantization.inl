@@ -0,0 +1,421 @@
+#pragma once
+
+namespace CinMath {
+	namespace Implementation {
+		/* Quantization constants of a smallest-three component with a given bit count */
+		template<std::uint32_t bits>
+		struct SmallestThree final
+		{
+			static constexpr std::uint32_t Mask{ (1U << bits) - 1U };
+			static constexpr float Maximum{ static_cast<float>(Mask - 1U) };
+			/* [-1 / sqrt(2), 1 / sqrt(2)] to [0, Maximum] and back, Maximum is even so that zero is exact. Decoding
+			 * subtracts the (exact) center before scaling, which stays exact at zero even when contracted to an FMA */
+			static constexpr float EncodeScale{ Maximum * 0.707106781186547524f };
+			static constexpr float EncodeBias{ Maximum * 0.5f };
+			static constexpr float DecodeScale{ 1.41421356237309505f / Maximum };
+		};
+
+		/* Octahedral coordinates, [-1, 1] to [0, 65534] and back, zero and the axes are exact */
+		struct Octahedral final
+		{
+			static constexpr float Maximum{ 65534.0f };
+			static constexpr float EncodeScale{ 32767.0f };
+			static constexpr float EncodeBias{ 32767.0f };
+			static constexpr float DecodeScale{ 1.0f / 32767.0f };
+		};
+
+		/*
+		 * value * scale + bias and a * a + b * b + c * c, fused exactly when the target has FMA. Left to the compiler,
+		 * contraction picks a different order in the scalar and the register paths and the bulk kernels stop
+		 * matching their scalar counterparts bit for bit
+		 */
+		CIN_MATH_INLINE float MultiplyAdd(const float value, const float scale, const float bias) noexcept
+		{
+#if defined(__FMA__)
+			return std::fma(value, scale, bias);
+#else
+			return value * scale + bias;
+#endif
+		}
+
+		CIN_MATH_INLINE float SumOfSquares(const float a, const float b, const float c) noexcept
+		{
+#if defined(__FMA__)
+			return std::fma(c, c, std::fma(b, b, a * a));
+#else
+			return a * a + b * b + c * c;
+#endif
+		}
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		CIN_MATH_INLINE __m128 CIN_MATH_CALL MultiplyAdd(const __m128 value, const __m128 scale, const __m128 bias) noexcept
+		{
+#if defined(__FMA__)
+			return _mm_fmadd_ps(value, scale, bias);
+#else
+			return _mm_add_ps(_mm_mul_ps(value, scale), bias);
+#endif
+		}
+
+		CIN_MATH_INLINE __m128 CIN_MATH_CALL SumOfSquares(const __m128 a, const __m128 b, const __m128 c) noexcept
+		{
+#if defined(__FMA__)
+			return _mm_fmadd_ps(c, c, _mm_fmadd_ps(b, b, _mm_mul_ps(a, a)));
+#else
+			return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+#endif
+		}
+#endif
+
+		/* Index of the largest component (first one on ties), the other three in order with the sign of the largest removed */
+		CIN_MATH_INLINE std::uint32_t SmallestThreeSplit(const TQuaternion<float>& quaternion, float(&stored)[3]) noexcept
+		{
+			std::uint32_t largest{ 0U };
+			float largestMagnitude{ std::fabs(quaternion.raw[0]) };
+			for (std::uint32_t i{ 1U }; i < 4U; ++i)
+			{
+				if (std::fabs(quaternion.raw[i]) > largestMagnitude)
+				{
+					largest = i;
+					largestMagnitude = std::fabs(quaternion.raw[i]);
+				}
+			}
+
+			const bool flip{ std::signbit(quaternion.raw[largest]) };
+			for (std::uint32_t i{ 0U }, j{ 0U }; i < 4U; ++i)
+				if (i != largest)
+					stored[j++] = flip ? -quaternion.raw[i] : quaternion.raw[i];
+
+			return largest;
+		}
+
+		/* The stored components back in place, the largest one rebuilt from the unit length */
+		CIN_MATH_INLINE TQuaternion<float> SmallestThreeJoin(const std::uint32_t largest, const float a, const float b, const float c) noexcept
+		{
+			const float missing{ std::sqrt(std::max(1.0f - SumOfSquares(a, b, c), 0.0f)) };
+
+			const float stored[3]{ a, b, c };
+			TQuaternion<float> result;
+			for (std::uint32_t i{ 0U }, j{ 0U }; i < 4U; ++i)
+				result.raw[i] = i == largest ? missing : stored[j++];
+
+			return result;
+		}
+
+		template<std::uint32_t bits>
+		CIN_MATH_INLINE std::uint32_t SmallestThreeQuantize(const float value) noexcept
+		{
+			using Constants = SmallestThree<bits>;
+			return static_cast<std::uint32_t>(std::nearbyint(std::min(std::max(MultiplyAdd(value, Constants::EncodeScale, Constants::EncodeBias), 0.0f), Constants::Maximum)));
+		}
+
+		template<std::uint32_t bits>
+		CIN_MATH_INLINE float SmallestThreeDequantize(const std::uint32_t value) noexcept
+		{
+			using Constants = SmallestThree<bits>;
+			return (static_cast<float>(value) - Constants::EncodeBias) * Constants::DecodeScale;
+		}
+
+		CIN_MATH_INLINE std::uint16_t OctahedralQuantize(const float value) noexcept
+		{
+			return static_cast<std::uint16_t>(std::nearbyint(std::min(std::max(MultiplyAdd(value, Octahedral::EncodeScale, Octahedral::EncodeBias), 0.0f), Octahedral::Maximum)));
+		}
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		/* onTrue where every bit of the mask lane is set, onFalse elsewhere */
+		CIN_MATH_INLINE __m128 CIN_MATH_CALL SelectMask(const __m128 mask, const __m128 onFalse, const __m128 onTrue) noexcept
+		{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE41_BIT)
+			return _mm_blendv_ps(onFalse, onTrue, mask);
+#else
+			return _mm_or_ps(_mm_and_ps(mask, onTrue), _mm_andnot_ps(mask, onFalse));
+#endif
+		}
+#endif
+	}
+
+	CIN_MATH_INLINE PackedQuaternion32 PackQuaternion32(const TQuaternion<float>& quaternion) noexcept
+	{
+		float stored[3];
+		const std::uint32_t largest{ Implementation::SmallestThreeSplit(quaternion, stored) };
+
+		return PackedQuaternion32
+		{
+			(largest << 30U) |
+			(Implementation::SmallestThreeQuantize<10U>(stored[0]) << 20U) |
+			(Implementation::SmallestThreeQuantize<10U>(stored[1]) << 10U) |
+			Implementation::SmallestThreeQuantize<10U>(stored[2])
+		};
+	}
+
+	CIN_MATH_INLINE PackedQuaternion48 PackQuaternion48(const TQuaternion<float>& quaternion) noexcept
+	{
+		float stored[3];
+		const std::uint32_t largest{ Implementation::SmallestThreeSplit(quaternion, stored) };
+
+		/* index << 45 | a << 30 | b << 15 | c, low 16 bits first */
+		const std::uint64_t bits
+		{
+			(static_cast<std::uint64_t>(largest) << 45U) |
+			(static_cast<std::uint64_t>(Implementation::SmallestThreeQuantize<15U>(stored[0])) << 30U) |
+			(static_cast<std::uint64_t>(Implementation::SmallestThreeQuantize<15U>(stored[1])) << 15U) |
+			static_cast<std::uint64_t>(Implementation::SmallestThreeQuantize<15U>(stored[2]))
+		};
+
+		return PackedQuaternion48
+		{
+			{ static_cast<std::uint16_t>(bits), static_cast<std::uint16_t>(bits >> 16U), static_cast<std::uint16_t>(bits >> 32U) }
+		};
+	}
+
+	CIN_MATH_INLINE PackedNormal32 PackNormal32(const Vector<3, float>& vector) noexcept
+	{
+		/* Project onto the octahedron |x| + |y| + |z| = 1, fold the lower half over the diagonals */
+		const float inverseNorm{ 1.0f / (std::fabs(vector.x) + std::fabs(vector.y) + std::fabs(vector.z)) };
+		float x{ vector.x * inverseNorm };
+		float y{ vector.y * inverseNorm };
+		if (vector.z < 0.0f)
+		{
+			const float foldedX{ std::copysign(1.0f - std::fabs(y), x) };
+			const float foldedY{ std::copysign(1.0f - std::fabs(x), y) };
+			x = foldedX;
+			y = foldedY;
+		}
+
+		return PackedNormal32{ Implementation::OctahedralQuantize(x), Implementation::OctahedralQuantize(y) };
+	}
+
+	CIN_MATH_INLINE TQuaternion<float> Unpack(const PackedQuaternion32 packed) noexcept
+	{
+		using Constants = Implementation::SmallestThree<10U>;
+		return Implementation::SmallestThreeJoin(packed.Bits >> 30U,
+			Implementation::SmallestThreeDequantize<10U>((packed.Bits >> 20U) & Constants::Mask),
+			Implementation::SmallestThreeDequantize<10U>((packed.Bits >> 10U) & Constants::Mask),
+			Implementation::SmallestThreeDequantize<10U>(packed.Bits & Constants::Mask));
+	}
+
+	CIN_MATH_INLINE TQuaternion<float> Unpack(const PackedQuaternion48 packed) noexcept
+	{
+		using Constants = Implementation::SmallestThree<15U>;
+		const std::uint64_t bits{ static_cast<std::uint64_t>(packed.Bits[0]) | (static_cast<std::uint64_t>(packed.Bits[1]) << 16U) | (static_cast<std::uint64_t>(packed.Bits[2]) << 32U) };
+
+		return Implementation::SmallestThreeJoin(static_cast<std::uint32_t>(bits >> 45U) & 0x3U,
+			Implementation::SmallestThreeDequantize<15U>(static_cast<std::uint32_t>(bits >> 30U) & Constants::Mask),
+			Implementation::SmallestThreeDequantize<15U>(static_cast<std::uint32_t>(bits >> 15U) & Constants::Mask),
+			Implementation::SmallestThreeDequantize<15U>(static_cast<std::uint32_t>(bits) & Constants::Mask));
+	}
+
+	CIN_MATH_INLINE Vector<3, float> Unpack(const PackedNormal32 packed) noexcept
+	{
+		using Constants = Implementation::Octahedral;
+		float x{ (static_cast<float>(packed.X) - Constants::EncodeBias) * Constants::DecodeScale };
+		float y{ (static_cast<float>(packed.Y) - Constants::EncodeBias) * Constants::DecodeScale };
+		const float z{ 1.0f - std::fabs(x) - std::fabs(y) };
+
+		/* Unfold the lower half */
+		const float fold{ std::max(0.0f, -z) };
+		x -= std::copysign(fold, x);
+		y -= std::copysign(fold, y);
+
+		const float length{ std::sqrt(Implementation::SumOfSquares(x, y, z)) };
+		return Vector<3, float>{ x / length, y / length, z / length };
+	}
+
+	CIN_MATH_INLINE void PackArray(const TQuaternion<float>* CIN_MATH_RESTRICT input, PackedQuaternion32* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		std::size_t i{ 0U };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		using Constants = Implementation::SmallestThree<10U>;
+		const __m128 signMask{ _mm_set1_ps(-0.0f) };
+		for (; i + 4U <= count; i += 4U)
+		{
+			/* One register per component, four quaternions per register */
+			__m128 q0{ input[i + 0U].data };
+			__m128 q1{ input[i + 1U].data };
+			__m128 q2{ input[i + 2U].data };
+			__m128 q3{ input[i + 3U].data };
+			_MM_TRANSPOSE4_PS(q0, q1, q2, q3);
+
+			/* Largest magnitude, the first one wins ties like in the scalar path */
+			__m128 largestMagnitude{ _mm_andnot_ps(signMask, q0) };
+			__m128 largestValue{ q0 };
+			__m128i largest{ _mm_setzero_si128() };
+			const __m128 components[3]{ q1, q2, q3 };
+			for (int component{ 0 }; component < 3; ++component)
+			{
+				const __m128 magnitude{ _mm_andnot_ps(signMask, components[component]) };
+				const __m128 greater{ _mm_cmpgt_ps(magnitude, largestMagnitude) };
+				largestMagnitude = Implementation::SelectMask(greater, largestMagnitude, magnitude);
+				largestValue = Implementation::SelectMask(greater, largestValue, components[component]);
+				largest = _mm_castps_si128(Implementation::SelectMask(greater, _mm_castsi128_ps(largest), _mm_castsi128_ps(_mm_set1_epi32(component + 1))));
+			}
+
+			const __m128 is0{ _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_setzero_si128())) };
+			const __m128 is1{ _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(1))) };
+			const __m128 is3{ _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(3))) };
+
+			/* Remove the sign of the largest component */
+			const __m128 flip{ _mm_and_ps(largestValue, signMask) };
+			q0 = _mm_xor_ps(q0, flip);
+			q1 = _mm_xor_ps(q1, flip);
+			q2 = _mm_xor_ps(q2, flip);
+			q3 = _mm_xor_ps(q3, flip);
+
+			const __m128 stored[3]
+			{
+				Implementation::SelectMask(is0, q0, q1),
+				Implementation::SelectMask(_mm_or_ps(is0, is1), q1, q2),
+				Implementation::SelectMask(is3, q3, q2)
+			};
+
+			__m128i bits{ _mm_slli_epi32(largest, 30) };
+			for (int component{ 0 }; component < 3; ++component)
+			{
+				__m128 value{ Implementation::MultiplyAdd(stored[component], _mm_set1_ps(Constants::EncodeScale), _mm_set1_ps(Constants::EncodeBias)) };
+				value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(Constants::Maximum));
+				bits = _mm_or_si128(bits, _mm_sll_epi32(_mm_cvtps_epi32(value), _mm_cvtsi32_si128(20 - 10 * component)));
+			}
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), bits);
+		}
+#endif
+		/* Remainder */
+		for (; i < count; ++i)
+			output[i] = PackQuaternion32(input[i]);
+	}
+
+	CIN_MATH_INLINE void PackArray(const TQuaternion<float>* CIN_MATH_RESTRICT input, PackedQuaternion48* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		/* 6 byte records do not map onto register lanes, the 64 bit arithmetic of the scalar path is cheap enough */
+		for (std::size_t i{ 0U }; i < count; ++i)
+			output[i] = PackQuaternion48(input[i]);
+	}
+
+	CIN_MATH_INLINE void PackArray(const Vector<3, float>* CIN_MATH_RESTRICT input, PackedNormal32* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		static_assert(sizeof(Vector<3, float>) == 3U * sizeof(float), "Vector3 must be tightly packed");
+		std::size_t i{ 0U };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		using Constants = Implementation::Octahedral;
+		const __m128 signMask{ _mm_set1_ps(-0.0f) };
+		const __m128 one{ _mm_set1_ps(1.0f) };
+		for (; i + 4U <= count; i += 4U)
+		{
+			/* Four 12 byte vectors, the last one is loaded from one float earlier to stay in bounds */
+			const float* const source{ reinterpret_cast<const float*>(input + i) };
+			__m128 x{ _mm_loadu_ps(source + 0U) };
+			__m128 y{ _mm_loadu_ps(source + 3U) };
+			__m128 z{ _mm_loadu_ps(source + 6U) };
+			__m128 w{ _mm_loadu_ps(source + 8U) };
+			w = _mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 3, 2, 1));
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			const __m128 norm{ _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)), _mm_andnot_ps(signMask, z)) };
+			const __m128 inverseNorm{ _mm_div_ps(one, norm) };
+			x = _mm_mul_ps(x, inverseNorm);
+			y = _mm_mul_ps(y, inverseNorm);
+
+			const __m128 foldedX{ _mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, y)), _mm_and_ps(x, signMask)) };
+			const __m128 foldedY{ _mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_and_ps(y, signMask)) };
+			const __m128 lower{ _mm_cmplt_ps(z, _mm_setzero_ps()) };
+			x = Implementation::SelectMask(lower, x, foldedX);
+			y = Implementation::SelectMask(lower, y, foldedY);
+
+			x = Implementation::MultiplyAdd(x, _mm_set1_ps(Constants::EncodeScale), _mm_set1_ps(Constants::EncodeBias));
+			y = Implementation::MultiplyAdd(y, _mm_set1_ps(Constants::EncodeScale), _mm_set1_ps(Constants::EncodeBias));
+			x = _mm_min_ps(_mm_max_ps(x, _mm_setzero_ps()), _mm_set1_ps(Constants::Maximum));
+			y = _mm_min_ps(_mm_max_ps(y, _mm_setzero_ps()), _mm_set1_ps(Constants::Maximum));
+
+			const __m128i bits{ _mm_or_si128(_mm_cvtps_epi32(x), _mm_slli_epi32(_mm_cvtps_epi32(y), 16)) };
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), bits);
+		}
+#endif
+		/* Remainder */
+		for (; i < count; ++i)
+			output[i] = PackNormal32(input[i]);
+	}
+
+	CIN_MATH_INLINE void UnpackArray(const PackedQuaternion32* CIN_MATH_RESTRICT input, TQuaternion<float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		std::size_t i{ 0U };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		using Constants = Implementation::SmallestThree<10U>;
+		const __m128i mask{ _mm_set1_epi32(static_cast<int>(Constants::Mask)) };
+		for (; i + 4U <= count; i += 4U)
+		{
+			const __m128i bits{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)) };
+			const __m128i largest{ _mm_srli_epi32(bits, 30) };
+
+			const __m128 a{ _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(bits, 20), mask)), _mm_set1_ps(Constants::EncodeBias)), _mm_set1_ps(Constants::DecodeScale)) };
+			const __m128 b{ _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(bits, 10), mask)), _mm_set1_ps(Constants::EncodeBias)), _mm_set1_ps(Constants::DecodeScale)) };
+			const __m128 c{ _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(_mm_and_si128(bits, mask)), _mm_set1_ps(Constants::EncodeBias)), _mm_set1_ps(Constants::DecodeScale)) };
+
+			const __m128 squaredLength{ Implementation::SumOfSquares(a, b, c) };
+			const __m128 missing{ _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), squaredLength), _mm_setzero_ps())) };
+
+			const __m128 is0{ _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_setzero_si128())) };
+			const __m128 is1{ _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(1))) };
+			const __m128 is2{ _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(2))) };
+			const __m128 is3{ _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(3))) };
+
+			/* Component k is the missing one, or stored component k (before the largest) or k - 1 (after it) */
+			__m128 q0{ Implementation::SelectMask(is0, a, missing) };
+			__m128 q1{ Implementation::SelectMask(is0, Implementation::SelectMask(is1, b, missing), a) };
+			__m128 q2{ Implementation::SelectMask(is2, Implementation::SelectMask(is3, b, c), missing) };
+			__m128 q3{ Implementation::SelectMask(is3, c, missing) };
+			_MM_TRANSPOSE4_PS(q0, q1, q2, q3);
+
+			output[i + 0U].data = q0;
+			output[i + 1U].data = q1;
+			output[i + 2U].data = q2;
+			output[i + 3U].data = q3;
+		}
+#endif
+		/* Remainder */
+		for (; i < count; ++i)
+			output[i] = Unpack(input[i]);
+	}
+
+	CIN_MATH_INLINE void UnpackArray(const PackedQuaternion48* CIN_MATH_RESTRICT input, TQuaternion<float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		for (std::size_t i{ 0U }; i < count; ++i)
+			output[i] = Unpack(input[i]);
+	}
+
+	CIN_MATH_INLINE void UnpackArray(const PackedNormal32* CIN_MATH_RESTRICT input, Vector<3, float>* CIN_MATH_RESTRICT output, const std::size_t count) noexcept
+	{
+		static_assert(sizeof(Vector<3, float>) == 3U * sizeof(float), "Vector3 must be tightly packed");
+		std::size_t i{ 0U };
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		using Constants = Implementation::Octahedral;
+		const __m128 signMask{ _mm_set1_ps(-0.0f) };
+		for (; i + 4U <= count; i += 4U)
+		{
+			const __m128i bits{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)) };
+			__m128 x{ _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(_mm_and_si128(bits, _mm_set1_epi32(0xFFFF))), _mm_set1_ps(Constants::EncodeBias)), _mm_set1_ps(Constants::DecodeScale)) };
+			__m128 y{ _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 16)), _mm_set1_ps(Constants::EncodeBias)), _mm_set1_ps(Constants::DecodeScale)) };
+			__m128 z{ _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_andnot_ps(signMask, x)), _mm_andnot_ps(signMask, y)) };
+
+			const __m128 fold{ _mm_max_ps(_mm_xor_ps(z, signMask), _mm_setzero_ps()) };
+			x = _mm_sub_ps(x, _mm_or_ps(fold, _mm_and_ps(x, signMask)));
+			y = _mm_sub_ps(y, _mm_or_ps(fold, _mm_and_ps(y, signMask)));
+
+			const __m128 length{ _mm_sqrt_ps(Implementation::SumOfSquares(x, y, z)) };
+			x = _mm_div_ps(x, length);
+			y = _mm_div_ps(y, length);
+			z = _mm_div_ps(z, length);
+
+			/* Back to 12 byte vectors: three overlapping 16 byte stores, the last vector without spilling past the end */
+			__m128 w{ _mm_setzero_ps() };
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			float* const destination{ reinterpret_cast<float*>(output + i) };
+			_mm_storeu_ps(destination + 0U, x);
+			_mm_storeu_ps(destination + 3U, y);
+			_mm_storeu_ps(destination + 6U, z);
+			_mm_storel_pi(reinterpret_cast<__m64*>(destination + 9U), w);
+			_mm_store_ss(destination + 11U, _mm_movehl_ps(w, w));
+		}
+#endif
+		/* Remainder */
+		for (; i < count; ++i)
+			output[i] = Unpack(input[i]);
+	}
+}
@@ -45,6 +45,16 @@ namespace CinMath {
 	template<Length_t length, typename ValueType>
 	CIN_MATH_INLINE Vector<length, ValueType> Normalize(const Vector<length, ValueType>& vector) noexcept;
 
+	/**
+	 * Normalizes a given vector with a reciprocal square root estimate refined by one Newton-Raphson step.
+	 * Relative error is about 1e-6 for Vector<4, float> under SSE, other types fall back to Normalize
+	 * 
+	 * @param input vector
+	 * @return normalized input vector
+	 */
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE Vector<length, ValueType> NormalizeFast(const Vector<length, ValueType>& vector) noexcept;
+
 	/**
 	 * Calculates the dot product of two vectors
 	 * 
@@ -83,7 +93,7 @@ namespace CinMath {
 	 * @return determinant value of input matrix
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE ValueType Determinant(const Matrix<rows, columns, ValueType>& matrix) noexcept;
+	constexpr CIN_MATH_INLINE ValueType Determinant(const Matrix<rows, columns, ValueType>& matrix) noexcept;
 
 	/**
 	 * Calculates the inverse of a given matrix
@@ -92,7 +102,7 @@ namespace CinMath {
 	 * @return inverse of input matrix
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> Inverse(const Matrix<rows, columns, ValueType>& matrix) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> Inverse(const Matrix<rows, columns, ValueType>& matrix) noexcept;
 
 	/**
 	 * Calculates the conjugate of a given quaternion
@@ -186,7 +196,7 @@ namespace CinMath {
 	 * @return Translated input matrix by the given input vector
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> Translate(const Matrix<rows, columns, ValueType>& matrix, const Vector<3, ValueType>& translation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> Translate(const Matrix<rows, columns, ValueType>& matrix, const Vector<3, ValueType>& translation) noexcept;
 
 	/**
 	 * Translates a given matrix by a vector
@@ -197,7 +207,7 @@ namespace CinMath {
 	 * @note The w component of translation component should be equal to 0
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> Translate(const Matrix<rows, columns, ValueType>& matrix, const Vector<4, ValueType>& translation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> Translate(const Matrix<rows, columns, ValueType>& matrix, const Vector<4, ValueType>& translation) noexcept;
 
 	/**
 	 * Translates an identity matrix by a vector
@@ -206,7 +216,7 @@ namespace CinMath {
 	 * @return Translated identity matrix by the given input vector
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> TranslateIdentity(const Vector<3, ValueType>& translation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> TranslateIdentity(const Vector<3, ValueType>& translation) noexcept;
 
 	/**
 	 * Translates an identity matrix by a vector
@@ -216,7 +226,7 @@ namespace CinMath {
 	 * @note The w component of translation component should be equal to 0
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> TranslateIdentity(const Vector<4, ValueType>& translation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> TranslateIdentity(const Vector<4, ValueType>& translation) noexcept;
 
 	/**
 	 * Rotates a given matrix by an angle (in radians) around an arbitrary axis
@@ -247,7 +257,7 @@ namespace CinMath {
 	 * @return Rotated input matrix by the input angle around the x axis
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateX(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateX(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept;
 
 	/**
 	 * Rotates an identity matrix by an angle (in radians) around the x axis
@@ -256,7 +266,7 @@ namespace CinMath {
 	 * @return Rotated identity matrix by the input angle around the x axis
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateXIdentity(const TAngle<ValueType> rotation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateXIdentity(const TAngle<ValueType> rotation) noexcept;
 
 	/**
 	 * Rotates a given matrix by an angle (in radians) around the y axis
@@ -266,7 +276,7 @@ namespace CinMath {
 	 * @return Rotated input matrix by the input angle around the y axis
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateY(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateY(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept;
 
 	/**
 	 * Rotates an identity matrix by an angle (in radians) around the y axis
@@ -275,7 +285,7 @@ namespace CinMath {
 	 * @return Rotated identity matrix by the input angle around the y axis
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateYIdentity(const TAngle<ValueType> rotation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateYIdentity(const TAngle<ValueType> rotation) noexcept;
 
 	/**
 	 * Rotates a given matrix by an angle (in radians) around the z axis
@@ -285,7 +295,7 @@ namespace CinMath {
 	 * @return Rotated input matrix by the input angle around the z axis
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateZ(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateZ(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept;
 
 	/**
 	 * Rotates an identity matrix by an angle (in radians) around the z axis
@@ -294,7 +304,7 @@ namespace CinMath {
 	 * @return Rotated identity matrix by the input angle around the z axis
 	 */
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateZIdentity(const TAngle<ValueType> rotation) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateZIdentity(const TAngle<ValueType> rotation) noexcept;
 
 	/**
 	 * Calculates the perspective projection
@@ -305,7 +315,7 @@ namespace CinMath {
 	 * @param orthoTop orthographic top
 	 */
 	template<typename ValueType>
-	CIN_MATH_INLINE Matrix<4, 4, ValueType> OrthographicProjection(const ValueType orthoLeft, const ValueType orthoRight, const ValueType orthoBottom, const ValueType orthoTop) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<4, 4, ValueType> OrthographicProjection(const ValueType orthoLeft, const ValueType orthoRight, const ValueType orthoBottom, const ValueType orthoTop) noexcept;
 
 	/**
 	 * Calculates the perspective projection
@@ -316,7 +326,41 @@ namespace CinMath {
 	 * @param farClip The far clip space
 	 */
 	template<typename ValueType>
-	CIN_MATH_INLINE Matrix<4, 4, ValueType> PerspectiveProjection(const ValueType FOV, const ValueType aspectRatio, const ValueType nearClip, const ValueType farClip) noexcept;
+	constexpr CIN_MATH_INLINE Matrix<4, 4, ValueType> PerspectiveProjection(const ValueType FOV, const ValueType aspectRatio, const ValueType nearClip, const ValueType farClip) noexcept;
+
+	/**
+	 * Splits an affine matrix into translation, rotation and scale, the inverse of Compose. The scale is the length of
+	 * the first three columns, negative along x when the matrix mirrors. Shear and projection are not represented
+	 *
+	 * @param input matrix, the scale components must not be zero
+	 * @param output translation
+	 * @param output rotation in unit form
+	 * @param output scale
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void Decompose(const Matrix<4, 4, ValueType>& matrix, Vector<3, ValueType>& translation, TQuaternion<ValueType>& rotation, Vector<3, ValueType>& scale) noexcept;
+
+	/**
+	 * Splits a rigid transformation (orthonormal rotation and translation, no scale) into translation and rotation.
+	 * Skips the column lengths and divisions of Decompose
+	 *
+	 * @param input matrix, the rotation part must be orthonormal
+	 * @param output translation
+	 * @param output rotation in unit form
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE void DecomposeOrthonormal(const Matrix<4, 4, ValueType>& matrix, Vector<3, ValueType>& translation, TQuaternion<ValueType>& rotation) noexcept;
+
+	/**
+	 * Builds translation * rotation * scale, so Compose(t, r, s) * point == t + Rotate(s * point, r) for a point with w = 1
+	 *
+	 * @param input translation
+	 * @param input rotation in unit form
+	 * @param input scale
+	 * @return affine matrix
+	 */
+	template<typename ValueType>
+	CIN_MATH_INLINE Matrix<4, 4, ValueType> Compose(const Vector<3, ValueType>& translation, const TQuaternion<ValueType>& rotation, const Vector<3, ValueType>& scale) noexcept;
 
 	namespace Implementation {
 		/* Vectors */
@@ -326,6 +370,9 @@ namespace CinMath {
 		template<Length_t length, typename ValueType>
 		struct VectorNormalize;
 
+		template<Length_t length, typename ValueType>
+		struct VectorNormalizeFast;
+
 		template<Length_t length, typename ValueType>
 		struct VectorDot;
 
@@ -406,6 +453,223 @@ namespace CinMath {
 		template<typename ValueType>
 		struct PerspectiveProjection;
 
+		template<typename ValueType>
+		struct MatrixDecompose;
+
+		template<typename ValueType>
+		struct MatrixCompose;
+
+		/* Scalar fallbacks used when a transform is evaluated at compile time. <cmath> and intrinsics are not usable there,
+		 * and matrix elements must be read through the named members (the active union member of a constant) */
+		namespace ConstantEvaluation {
+			/*
+			 * Reduces an angle to [-pi, pi], the series of Sin and Cos converge quickly there. Works like fmod: the
+			 * largest 2pi * 2^k not above the angle is subtracted first, every subtraction is exact, and no integer
+			 * cast limits the range of the angle
+			 */
+			constexpr long double ReduceAngle(const long double radians) noexcept
+			{
+				/* Infinity and NaN have no reduction, their sine and cosine are NaN */
+				if (!(radians >= -std::numeric_limits<long double>::max() && radians <= std::numeric_limits<long double>::max()))
+					return std::numeric_limits<long double>::quiet_NaN();
+
+				constexpr long double PI{ Constants::PI<long double> };
+				constexpr long double twoPI{ 2.0L * PI };
+				long double remainder{ radians < 0.0L ? -radians : radians };
+
+				long double multiple{ twoPI };
+				while (multiple <= remainder * 0.5L)
+					multiple *= 2.0L;
+
+				for (; multiple >= twoPI; multiple *= 0.5L)
+					if (remainder >= multiple)
+						remainder -= multiple;
+
+				if (remainder > PI)
+					remainder -= twoPI;
+
+				return radians < 0.0L ? -remainder : remainder;
+			}
+
+			template<typename ValueType>
+			constexpr ValueType Sin(const ValueType radians) noexcept
+			{
+				const long double x{ ReduceAngle(static_cast<long double>(radians)) };
+
+				const long double xSquared{ x * x };
+				long double term{ x };
+				long double sum{ x };
+				for (int n{ 1 }; n < 32 && term != 0.0L; ++n)
+				{
+					term *= -xSquared / static_cast<long double>((2 * n) * (2 * n + 1));
+					sum += term;
+				}
+
+				return static_cast<ValueType>(sum);
+			}
+
+			template<typename ValueType>
+			constexpr ValueType Cos(const ValueType radians) noexcept
+			{
+				const long double x{ ReduceAngle(static_cast<long double>(radians)) };
+
+				const long double xSquared{ x * x };
+				long double term{ 1.0L };
+				long double sum{ 1.0L };
+				for (int n{ 1 }; n < 32 && term != 0.0L; ++n)
+				{
+					term *= -xSquared / static_cast<long double>((2 * n - 1) * (2 * n));
+					sum += term;
+				}
+
+				return static_cast<ValueType>(sum);
+			}
+
+			template<typename ValueType>
+			constexpr ValueType Tan(const ValueType radians) noexcept
+			{
+				return static_cast<ValueType>(static_cast<long double>(Sin<long double>(radians)) / Cos<long double>(radians));
+			}
+
+			template<typename ValueType>
+			constexpr ValueType Sqrt(const ValueType value) noexcept
+			{
+				if (!(value > static_cast<ValueType>(0)))
+					return value == static_cast<ValueType>(0) ? value : std::numeric_limits<ValueType>::quiet_NaN();
+
+				long double current{ static_cast<long double>(value) };
+				long double previous{ 0.0L };
+				while (current != previous)
+				{
+					previous = current;
+					current = 0.5L * (current + static_cast<long double>(value) / current);
+				}
+
+				return static_cast<ValueType>(current);
+			}
+
+			template<typename ValueType>
+			constexpr std::array<ValueType, 4 * 4> Elements(const Matrix<4, 4, ValueType>& matrix) noexcept
+			{
+				return std::array<ValueType, 4 * 4>
+				{
+					matrix.m11, matrix.m12, matrix.m13, matrix.m14,
+					matrix.m21, matrix.m22, matrix.m23, matrix.m24,
+					matrix.m31, matrix.m32, matrix.m33, matrix.m34,
+					matrix.m41, matrix.m42, matrix.m43, matrix.m44
+				};
+			}
+
+			template<typename ValueType>
+			constexpr Matrix<4, 4, ValueType> Multiply(const Matrix<4, 4, ValueType>& lhs, const Matrix<4, 4, ValueType>& rhs) noexcept
+			{
+				const std::array<ValueType, 4 * 4> a{ Elements(lhs) };
+				const std::array<ValueType, 4 * 4> b{ Elements(rhs) };
+				std::array<ValueType, 4 * 4> result{};
+
+				/* Same summation order as the scalar operator* */
+				for (Length_t column{ 0U }; column < 4U; ++column)
+					for (Length_t row{ 0U }; row < 4U; ++row)
+						result[column * 4U + row] =
+							b[column * 4U + 0U] * a[0U + row] + b[column * 4U + 1U] * a[4U + row] +
+							b[column * 4U + 2U] * a[8U + row] + b[column * 4U + 3U] * a[12U + row];
+
+				return Matrix<4, 4, ValueType>{ std::move(result) };
+			}
+
+			template<typename ValueType>
+			constexpr ValueType Determinant(const std::array<ValueType, 4 * 4>& matrix) noexcept
+			{
+				const ValueType e00{ matrix[10] * matrix[15] - matrix[14] * matrix[11] };
+				const ValueType e01{ matrix[9] * matrix[15] - matrix[13] * matrix[11] };
+				const ValueType e02{ matrix[9] * matrix[14] - matrix[13] * matrix[10] };
+
+				const ValueType e03{ matrix[8] * matrix[15] - matrix[12] * matrix[11] };
+				const ValueType e04{ matrix[8] * matrix[14] - matrix[12] * matrix[10] };
+				const ValueType e05{ matrix[8] * matrix[13] - matrix[12] * matrix[9] };
+
+				const ValueType m00{ matrix[5] * e00 - matrix[6] * e01 + matrix[7] * e02 };
+				const ValueType m01{ matrix[4] * e00 - matrix[6] * e03 + matrix[7] * e04 };
+
+				const ValueType m02{ matrix[4] * e01 - matrix[5] * e03 + matrix[7] * e05 };
+				const ValueType m03{ matrix[4] * e02 - matrix[5] * e04 + matrix[6] * e05 };
+
+				return matrix[0] * m00 - matrix[1] * m01 + matrix[2] * m02 - matrix[3] * m03;
+			}
+
+			template<typename ValueType>
+			constexpr Matrix<4, 4, ValueType> Inverse(const std::array<ValueType, 4 * 4>& m) noexcept
+			{
+				const ValueType oneOverDeterminant{ static_cast<ValueType>(1) / Determinant(m) };
+
+				/* Cofactors Dij, see MatrixInverse<4, 4> */
+				const ValueType D11{ +(m[5] * (m[10] * m[15] - m[14] * m[11]) - m[9] * (m[6] * m[15] - m[14] * m[7]) + m[13] * (m[6] * m[11] - m[10] * m[7])) };
+				const ValueType D12{ -(m[4] * (m[10] * m[15] - m[14] * m[11]) - m[8] * (m[6] * m[15] - m[14] * m[7]) + m[12] * (m[6] * m[11] - m[10] * m[7])) };
+				const ValueType D13{ +(m[4] * (m[9] * m[15] - m[13] * m[11]) - m[8] * (m[5] * m[15] - m[13] * m[7]) + m[12] * (m[5] * m[11] - m[9] * m[7])) };
+				const ValueType D14{ -(m[4] * (m[9] * m[14] - m[13] * m[10]) - m[8] * (m[5] * m[14] - m[13] * m[6]) + m[12] * (m[5] * m[10] - m[9] * m[6])) };
+
+				const ValueType D21{ -(m[1] * (m[10] * m[15] - m[14] * m[11]) - m[9] * (m[2] * m[15] - m[14] * m[3]) + m[13] * (m[2] * m[11] - m[10] * m[3])) };
+				const ValueType D22{ +(m[0] * (m[10] * m[15] - m[14] * m[11]) - m[8] * (m[2] * m[15] - m[14] * m[3]) + m[12] * (m[2] * m[11] - m[10] * m[3])) };
+				const ValueType D23{ -(m[0] * (m[9] * m[15] - m[13] * m[11]) - m[8] * (m[1] * m[15] - m[13] * m[3]) + m[12] * (m[1] * m[11] - m[9] * m[3])) };
+				const ValueType D24{ +(m[0] * (m[9] * m[14] - m[13] * m[10]) - m[8] * (m[1] * m[14] - m[13] * m[2]) + m[12] * (m[1] * m[10] - m[9] * m[2])) };
+
+				const ValueType D31{ +(m[1] * (m[6] * m[15] - m[14] * m[7]) - m[5] * (m[2] * m[15] - m[14] * m[3]) + m[13] * (m[2] * m[7] - m[6] * m[3])) };
+				const ValueType D32{ -(m[0] * (m[6] * m[15] - m[14] * m[7]) - m[4] * (m[2] * m[15] - m[14] * m[3]) + m[12] * (m[2] * m[7] - m[6] * m[3])) };
+				const ValueType D33{ +(m[0] * (m[5] * m[15] - m[13] * m[7]) - m[4] * (m[1] * m[15] - m[13] * m[3]) + m[12] * (m[1] * m[7] - m[5] * m[3])) };
+				const ValueType D34{ -(m[0] * (m[5] * m[14] - m[13] * m[6]) - m[4] * (m[1] * m[14] - m[13] * m[2]) + m[12] * (m[1] * m[6] - m[5] * m[2])) };
+
+				const ValueType D41{ -(m[1] * (m[6] * m[11] - m[10] * m[7]) - m[5] * (m[2] * m[11] - m[10] * m[3]) + m[9] * (m[2] * m[7] - m[6] * m[3])) };
+				const ValueType D42{ +(m[0] * (m[6] * m[11] - m[10] * m[7]) - m[4] * (m[2] * m[11] - m[10] * m[3]) + m[8] * (m[2] * m[7] - m[6] * m[3])) };
+				const ValueType D43{ -(m[0] * (m[5] * m[11] - m[9] * m[7]) - m[4] * (m[1] * m[11] - m[9] * m[3]) + m[8] * (m[1] * m[7] - m[5] * m[3])) };
+				const ValueType D44{ +(m[0] * (m[5] * m[10] - m[9] * m[6]) - m[4] * (m[1] * m[10] - m[9] * m[2]) + m[8] * (m[1] * m[6] - m[5] * m[2])) };
+
+				/* Constructed already transposed */
+				return Matrix<4, 4, ValueType>
+				{
+					D11 * oneOverDeterminant, D21 * oneOverDeterminant, D31 * oneOverDeterminant, D41 * oneOverDeterminant,
+					D12 * oneOverDeterminant, D22 * oneOverDeterminant, D32 * oneOverDeterminant, D42 * oneOverDeterminant,
+					D13 * oneOverDeterminant, D23 * oneOverDeterminant, D33 * oneOverDeterminant, D43 * oneOverDeterminant,
+					D14 * oneOverDeterminant, D24 * oneOverDeterminant, D34 * oneOverDeterminant, D44 * oneOverDeterminant
+				};
+			}
+		}
+
+		template<typename ValueType>
+		constexpr CIN_MATH_INLINE ValueType Sin(const ValueType radians) noexcept
+		{
+			if (std::is_constant_evaluated())
+				return ConstantEvaluation::Sin(radians);
+
+			return std::sin(radians);
+		}
+
+		template<typename ValueType>
+		constexpr CIN_MATH_INLINE ValueType Cos(const ValueType radians) noexcept
+		{
+			if (std::is_constant_evaluated())
+				return ConstantEvaluation::Cos(radians);
+
+			return std::cos(radians);
+		}
+
+		template<typename ValueType>
+		constexpr CIN_MATH_INLINE ValueType Tan(const ValueType radians) noexcept
+		{
+			if (std::is_constant_evaluated())
+				return ConstantEvaluation::Tan(radians);
+
+			return std::tan(radians);
+		}
+
+		template<typename ValueType>
+		constexpr CIN_MATH_INLINE Matrix<4, 4, ValueType> Multiply(const Matrix<4, 4, ValueType>& lhs, const Matrix<4, 4, ValueType>& rhs) noexcept
+		{
+			if (std::is_constant_evaluated())
+				return ConstantEvaluation::Multiply(lhs, rhs);
+
+			return lhs * rhs;
+		}
+
 		/* Vector length */
 		template<typename ValueType>
 		struct VectorLength<2, ValueType> final
@@ -434,6 +698,75 @@ namespace CinMath {
 			}
 		};
 
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		/* Dot product of two registers, broadcast to every lane */
+		CIN_MATH_INLINE __m128 CIN_MATH_CALL DotBroadcast(const __m128 lhs, const __m128 rhs) noexcept
+		{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE41_BIT)
+			return _mm_dp_ps(lhs, rhs, 0xFF);
+#else
+			return SumBroadcast(_mm_mul_ps(lhs, rhs));
+#endif
+		}
+#endif
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		CIN_MATH_INLINE __m128d CIN_MATH_CALL DotBroadcast(const __m128d lhs, const __m128d rhs) noexcept
+		{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE41_BIT)
+			return _mm_dp_pd(lhs, rhs, 0x33);
+#else
+			const __m128d product{ _mm_mul_pd(lhs, rhs) };
+			return _mm_add_pd(product, _mm_shuffle_pd(product, product, 0b01));
+#endif
+		}
+#endif
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		CIN_MATH_INLINE __m256d CIN_MATH_CALL DotBroadcast(const __m256d lhs, const __m256d rhs) noexcept
+		{
+			/* (x + y, x + y, z + w, z + w), then the 128 bit halves swapped and added */
+			const __m256d pairs{ _mm256_hadd_pd(_mm256_mul_pd(lhs, rhs), _mm256_mul_pd(lhs, rhs)) };
+			return _mm256_add_pd(pairs, _mm256_permute2f128_pd(pairs, pairs, 0x01));
+		}
+#endif
+		template<>
+		struct VectorLength<2, double> final
+		{
+			CIN_MATH_INLINE static double implementation(const Vector<2, double>& vector) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+				return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), DotBroadcast(vector.data, vector.data)));
+#else
+				return std::sqrt(vector.raw[0] * vector.raw[0] + vector.raw[1] * vector.raw[1]);
+#endif
+			}
+		};
+
+		template<>
+		struct VectorLength<4, double> final
+		{
+			CIN_MATH_INLINE static double implementation(const Vector<4, double>& vector) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+				return std::sqrt(_mm256_cvtsd_f64(DotBroadcast(vector.data, vector.data)));
+#else
+				return std::sqrt(vector.raw[0] * vector.raw[0] + vector.raw[1] * vector.raw[1] + vector.raw[2] * vector.raw[2] + vector.raw[3] * vector.raw[3]);
+#endif
+			}
+		};
+
+		template<>
+		struct VectorLength<4, float> final
+		{
+			CIN_MATH_INLINE static float implementation(const Vector<4, float>& vector) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+				return _mm_cvtss_f32(_mm_sqrt_ss(DotBroadcast(vector.data, vector.data)));
+#else
+				return std::sqrt(vector.raw[0] * vector.raw[0] + vector.raw[1] * vector.raw[1] + vector.raw[2] * vector.raw[2] + vector.raw[3] * vector.raw[3]);
+#endif
+			}
+		};
+
 		/* Vector normalize */
 		template<typename ValueType>
 		struct VectorNormalize<2, ValueType> final
@@ -462,6 +795,77 @@ namespace CinMath {
 			}
 		};
 
+		template<>
+		struct VectorNormalize<4, float> final
+		{
+			CIN_MATH_INLINE static Vector<4, float> implementation(const Vector<4, float>& vector) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+				/* The length stays in every lane, no round trip through a scalar */
+				Vector<4, float> result;
+				result.data = _mm_div_ps(vector.data, _mm_sqrt_ps(DotBroadcast(vector.data, vector.data)));
+				return result;
+#else
+				return vector / Length(vector);
+#endif
+			}
+		};
+
+		template<>
+		struct VectorNormalize<2, double> final
+		{
+			CIN_MATH_INLINE static Vector<2, double> implementation(const Vector<2, double>& vector) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+				Vector<2, double> result;
+				result.data = _mm_div_pd(vector.data, _mm_sqrt_pd(DotBroadcast(vector.data, vector.data)));
+				return result;
+#else
+				return vector / Length(vector);
+#endif
+			}
+		};
+
+		template<>
+		struct VectorNormalize<4, double> final
+		{
+			CIN_MATH_INLINE static Vector<4, double> implementation(const Vector<4, double>& vector) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+				Vector<4, double> result;
+				result.data = _mm256_div_pd(vector.data, _mm256_sqrt_pd(DotBroadcast(vector.data, vector.data)));
+				return result;
+#else
+				return vector / Length(vector);
+#endif
+			}
+		};
+
+		/* Vector fast normalize */
+		template<Length_t length, typename ValueType>
+		struct VectorNormalizeFast final
+		{
+			CIN_MATH_INLINE static Vector<length, ValueType> implementation(const Vector<length, ValueType>& vector) noexcept
+			{
+				return Normalize(vector);
+			}
+		};
+
+		template<>
+		struct VectorNormalizeFast<4, float> final
+		{
+			CIN_MATH_INLINE static Vector<4, float> implementation(const Vector<4, float>& vector) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+				Vector<4, float> result;
+				result.data = _mm_mul_ps(vector.data, ReciprocalSqrt(DotBroadcast(vector.data, vector.data)));
+				return result;
+#else
+				return Normalize(vector);
+#endif
+			}
+		};
+
 		/* Dot product */
 		template<typename ValueType>
 		struct VectorDot<2, ValueType> final
@@ -490,6 +894,45 @@ namespace CinMath {
 			}
 		};
 
+		template<>
+		struct VectorDot<4, float> final
+		{
+			CIN_MATH_INLINE static float implementation(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+				return _mm_cvtss_f32(DotBroadcast(lhs.data, rhs.data));
+#else
+				return lhs.raw[0] * rhs.raw[0] + lhs.raw[1] * rhs.raw[1] + lhs.raw[2] * rhs.raw[2] + lhs.raw[3] * rhs.raw[3];
+#endif
+			}
+		};
+
+		template<>
+		struct VectorDot<2, double> final
+		{
+			CIN_MATH_INLINE static double implementation(const Vector<2, double>& lhs, const Vector<2, double>& rhs) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+				return _mm_cvtsd_f64(DotBroadcast(lhs.data, rhs.data));
+#else
+				return lhs.raw[0] * rhs.raw[0] + lhs.raw[1] * rhs.raw[1];
+#endif
+			}
+		};
+
+		template<>
+		struct VectorDot<4, double> final
+		{
+			CIN_MATH_INLINE static double implementation(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+			{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+				return _mm256_cvtsd_f64(DotBroadcast(lhs.data, rhs.data));
+#else
+				return lhs.raw[0] * rhs.raw[0] + lhs.raw[1] * rhs.raw[1] + lhs.raw[2] * rhs.raw[2] + lhs.raw[3] * rhs.raw[3];
+#endif
+			}
+		};
+
 		/* Cross product */
 		template<typename ValueType>
 		struct VectorCross<3, ValueType> final
@@ -550,9 +993,19 @@ namespace CinMath {
 		template<typename ValueType>
 		struct MatrixTranslate<4, 4, ValueType> final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Matrix<4, 4, float>& matrix, const Vector<3, float>& translation)
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const Matrix<4, 4, ValueType>& matrix, const Vector<3, ValueType>& translation)
 			{
-				Matrix<4, 4, float> result(matrix);
+				if (std::is_constant_evaluated())
+				{
+					std::array<ValueType, 4 * 4> result{ ConstantEvaluation::Elements(matrix) };
+					result[12] += translation.x * result[0];
+					result[13] += translation.y * result[10];
+					result[14] += translation.z * result[15];
+
+					return Matrix<4, 4, ValueType>{ std::move(result) };
+				}
+
+				Matrix<4, 4, ValueType> result(matrix);
 
 				result.raw[12] += translation.raw[0] * result.raw[0];
 				result.raw[13] += translation.raw[1] * result.raw[10];
@@ -561,41 +1014,34 @@ namespace CinMath {
 				return result;
 			}
 
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Matrix<4, 4, float>& matrix, const Vector<4, float>& translation)
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const Matrix<4, 4, ValueType>& matrix, const Vector<4, ValueType>& translation)
 			{
-				Matrix<4, 4, float> result(matrix);
-				assert(translation.w == 0.0f);
-				result.raw[12] += translation.raw[0] * result.raw[0];
-				result.raw[13] += translation.raw[1] * result.raw[10];
-				result.raw[14] += translation.raw[2] * result.raw[15];
-
-				return result;
+				assert(translation.w == static_cast<ValueType>(0));
+				return implementation(matrix, Vector<3, ValueType>{ translation.x, translation.y, translation.z });
 			}
 		};
 
 		template<typename ValueType>
 		struct MatrixTranslateIdentity<4, 4, ValueType> final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Vector<3, float>& translation)
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const Vector<3, ValueType>& translation)
 			{
-				return Matrix<4, 4, float> {
-					1.0f, 0.0f, 0.0f, 0.0f,
-					0.0f, 1.0f, 0.0f, 0.0f,
-					0.0f, 0.0f, 1.0f, 0.0f,
-					translation.raw[0], translation.raw[1], translation.raw[2], 1.0f
+				constexpr ValueType zero{ static_cast<ValueType>(0) };
+				constexpr ValueType one{ static_cast<ValueType>(1) };
+
+				return Matrix<4, 4, ValueType>
+				{
+					one, zero, zero, zero,
+					zero, one, zero, zero,
+					zero, zero, one, zero,
+					translation.x, translation.y, translation.z, one
 				};
 			}
 
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Vector<4, float>& translation)
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const Vector<4, ValueType>& translation)
 			{
-				assert(translation.w == 0.0f);
-				return Matrix<4, 4, float> 
-				{
-					1.0f, 0.0f, 0.0f, 0.0f,
-					0.0f, 1.0f, 0.0f, 0.0f,
-					0.0f, 0.0f, 1.0f, 0.0f,
-					translation.raw[0], translation.raw[1], translation.raw[2], 1.0f
-				};
+				assert(translation.w == static_cast<ValueType>(0));
+				return implementation(Vector<3, ValueType>{ translation.x, translation.y, translation.z });
 			}
 		};
 
@@ -674,54 +1120,29 @@ namespace CinMath {
 		template<Length_t rows, Length_t columns, typename ValueType>
 		struct MatrixRotateX final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Matrix<4, 4, ValueType>& matrix, const ValueType rotation) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const Matrix<4, 4, ValueType>& matrix, const ValueType rotation) noexcept
 			{
-				const float s{ std::sin(rotation) };
-				const float c{ std::cos(rotation) };
-
-				return Matrix<4, 4, float>
-				{
-					{
-						1.0f, 0.0f, 0.0f, 0.0f,
-						0.0f, c, -s, 0.0f,
-						0.0f, s, c, 0.0f,
-						0.0f, 0.0f, 0.0f, 1.0f
-					}
-				} * matrix;
+				return Multiply(MatrixRotateXIdentity<rows, columns, ValueType>::implementation(rotation), matrix);
 			}
 		};
 
 		template<Length_t rows, Length_t columns, typename ValueType>
 		struct MatrixRotateXIdentity final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const float rotation) noexcept
-			{
-				const float s{ std::sin(rotation) };
-				const float c{ std::cos(rotation) };
-
-				return Matrix<4, 4, float>
-				{
-					{
-						1.0f, 0.0f, 0.0f, 0.0f,
-						0.0f, c,	-s,	  0.0f,
-						0.0f, s,	 c,	  0.0f,
-						0.0f, 0.0f, 0.0f, 1.0f
-					}
-				};
-			}
-
-			CIN_MATH_INLINE static Matrix<4, 4, double> implementation(const double rotation) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const ValueType rotation) noexcept
 			{
-				const double s{ std::sin(rotation) };
-				const double c{ std::cos(rotation) };
+				constexpr ValueType zero{ static_cast<ValueType>(0) };
+				constexpr ValueType one{ static_cast<ValueType>(1) };
+				const ValueType s{ Sin(rotation) };
+				const ValueType c{ Cos(rotation) };
 
-				return Matrix<4, 4, double>
+				return Matrix<4, 4, ValueType>
 				{
 					{
-						1.0f, 0.0f, 0.0f, 0.0f,
-						0.0f, c,	-s,	  0.0f,
-						0.0f, s,	 c,	  0.0f,
-						0.0f, 0.0f, 0.0f, 1.0f
+						one,  zero, zero, zero,
+						zero, c,	-s,	  zero,
+						zero, s,	 c,	  zero,
+						zero, zero, zero, one
 					}
 				};
 			}
@@ -730,38 +1151,29 @@ namespace CinMath {
 		template<Length_t rows, Length_t columns, typename ValueType>
 		struct MatrixRotateY final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Matrix<4, 4, ValueType>& matrix, const ValueType rotation) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const Matrix<4, 4, ValueType>& matrix, const ValueType rotation) noexcept
 			{
-				const float s{ std::sin(rotation) };
-				const float c{ std::cos(rotation) };
-
-				return Matrix<4, 4, float>
-				{
-					{
-						c, 0.0f, s, 0.0f,
-						0.0f, 1.0f, 0.0f, 0.0f,
-						-s, 0.0f, c, 0.0f,
-						0.0f, 0.0f, 0.0f, 1.0f
-					}
-				} * matrix;
+				return Multiply(MatrixRotateYIdentity<rows, columns, ValueType>::implementation(rotation), matrix);
 			}
 		};
 
 		template<Length_t rows, Length_t columns, typename ValueType>
 		struct MatrixRotateYIdentity final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const ValueType rotation) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const ValueType rotation) noexcept
 			{
-				const float s{ std::sin(rotation) };
-				const float c{ std::cos(rotation) };
+				constexpr ValueType zero{ static_cast<ValueType>(0) };
+				constexpr ValueType one{ static_cast<ValueType>(1) };
+				const ValueType s{ Sin(rotation) };
+				const ValueType c{ Cos(rotation) };
 
-				return Matrix<4, 4, float>
+				return Matrix<4, 4, ValueType>
 				{
 					{
-						c, 0.0f, s, 0.0f,
-						0.0f, 1.0f, 0.0f, 0.0f,
-						-s, 0.0f, c, 0.0f,
-						0.0f, 0.0f, 0.0f, 1.0f
+						c,	  zero, s,	  zero,
+						zero, one,  zero, zero,
+						-s,	  zero, c,	  zero,
+						zero, zero, zero, one
 					}
 				};
 			}
@@ -770,38 +1182,29 @@ namespace CinMath {
 		template<Length_t rows, Length_t columns, typename ValueType>
 		struct MatrixRotateZ final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Matrix<4, 4, ValueType>& matrix, const ValueType rotation) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const Matrix<4, 4, ValueType>& matrix, const ValueType rotation) noexcept
 			{
-				const float s{ std::sin(rotation) };
-				const float c{ std::cos(rotation) };
-
-				return Matrix<4, 4, float>
-				{
-					{
-						c, -s, 0.0f, 0.0f,
-						s, c, 0.0f, 0.0f,
-						0.0f, 0.0f, 1.0f, 0.0f,
-						0.0f, 0.0f, 0.0f, 1.0f,
-					}
-				} * matrix;
+				return Multiply(MatrixRotateZIdentity<rows, columns, ValueType>::implementation(rotation), matrix);
 			}
 		};
 
 		template<Length_t rows, Length_t columns, typename ValueType>
 		struct MatrixRotateZIdentity final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const ValueType rotation) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const ValueType rotation) noexcept
 			{
-				const float s{ std::sin(rotation) };
-				const float c{ std::cos(rotation) };
+				constexpr ValueType zero{ static_cast<ValueType>(0) };
+				constexpr ValueType one{ static_cast<ValueType>(1) };
+				const ValueType s{ Sin(rotation) };
+				const ValueType c{ Cos(rotation) };
 
-				return Matrix<4, 4, float>
+				return Matrix<4, 4, ValueType>
 				{
 					{
-						c, -s, 0.0f, 0.0f,
-						s, c, 0.0f, 0.0f,
-						0.0f, 0.0f, 1.0f, 0.0f,
-						0.0f, 0.0f, 0.0f, 1.0f,
+						c,	  -s,	zero, zero,
+						s,	  c,	zero, zero,
+						zero, zero, one,  zero,
+						zero, zero, zero, one
 					}
 				};
 			}
@@ -810,35 +1213,20 @@ namespace CinMath {
 		template<Length_t rows, Length_t columns, typename ValueType>
 		struct MatrixScale final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Matrix<4, 4, float>& matrix, const Vector<3, float>& scale) noexcept
+			CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const Matrix<4, 4, ValueType>& matrix, const Vector<3, ValueType>& scale) noexcept
 			{
-				Matrix<4, 4, float> result;
-#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX)
-				result.raw[0] = matrix.raw[0] * scale.x;
-				result.raw[1] = matrix.raw[1] * scale.x;
-				result.raw[2] = matrix.raw[2] * scale.x;
-				result.raw[3] = matrix.raw[3] * scale.x;
-
-				result.raw[4] = matrix.raw[4] * scale.y;
-				result.raw[5] = matrix.raw[5] * scale.y;
-				result.raw[6] = matrix.raw[6] * scale.y;
-				result.raw[7] = matrix.raw[7] * scale.y;
-
-				result.raw[8] = matrix.raw[8] * scale.z;
-				result.raw[9] = matrix.raw[9] * scale.z;
-				result.raw[10] = matrix.raw[10] * scale.z;
-				result.raw[11] = matrix.raw[11] * scale.z;
-
-				result.raw[12] = matrix.raw[12];
-				result.raw[13] = matrix.raw[13];
-				result.raw[14] = matrix.raw[14];
-				result.raw[15] = matrix.raw[15];
-#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE)
-				result.data[0] = _mm_mul_ps(matrix.data[0], _mm_set_ps(scale.x, scale.x, scale.x, scale.x));
-				result.data[1] = _mm_mul_ps(matrix.data[1], _mm_set_ps(scale.y, scale.y, scale.y, scale.y));
-				result.data[2] = _mm_mul_ps(matrix.data[2], _mm_set_ps(scale.z, scale.z, scale.z, scale.z));
-				result.data[3] = matrix.data[3];
-#else
+				Matrix<4, 4, ValueType> result;
+				/* AVX tiers keep float matrices in two __m256 halves, the scalar code below vectorizes as well */
+#if ((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)) && !((CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT))
+				if constexpr (std::is_same_v<ValueType, float>)
+				{
+					result.data[0] = _mm_mul_ps(matrix.data[0], _mm_set1_ps(scale.x));
+					result.data[1] = _mm_mul_ps(matrix.data[1], _mm_set1_ps(scale.y));
+					result.data[2] = _mm_mul_ps(matrix.data[2], _mm_set1_ps(scale.z));
+					result.data[3] = matrix.data[3];
+					return result;
+				}
+#endif
 				result.raw[0] = matrix.raw[0] * scale.x;
 				result.raw[1] = matrix.raw[1] * scale.x;
 				result.raw[2] = matrix.raw[2] * scale.x;
@@ -858,7 +1246,6 @@ namespace CinMath {
 				result.raw[13] = matrix.raw[13];
 				result.raw[14] = matrix.raw[14];
 				result.raw[15] = matrix.raw[15];
-#endif
 				return result;
 			}
 		};
@@ -1073,8 +1460,11 @@ namespace CinMath {
 		template<typename ValueType>
 		struct MatrixDeterminant<4, 4, ValueType> final
 		{
-			CIN_MATH_INLINE static float implementation(const Matrix<4, 4, float>& matrix) noexcept
+			constexpr CIN_MATH_INLINE static float implementation(const Matrix<4, 4, float>& matrix) noexcept
 			{
+				if (std::is_constant_evaluated())
+					return ConstantEvaluation::Determinant(ConstantEvaluation::Elements(matrix));
+
 				const float e00{ matrix[10] * matrix[15] - matrix[14] * matrix[11] };
 				const float e01{ matrix[9] * matrix[15] - matrix[13] * matrix[11] };
 				const float e02{ matrix[9] * matrix[14] - matrix[13] * matrix[10] };
@@ -1092,8 +1482,11 @@ namespace CinMath {
 				return matrix[0] * m00 - matrix[1] * m01 + matrix[2] * m02 - matrix[3] * m03;
 			}
 
-			CIN_MATH_INLINE static double implementation(const Matrix<4, 4, double>& matrix) noexcept
+			constexpr CIN_MATH_INLINE static double implementation(const Matrix<4, 4, double>& matrix) noexcept
 			{
+				if (std::is_constant_evaluated())
+					return ConstantEvaluation::Determinant(ConstantEvaluation::Elements(matrix));
+
 				const double e00{ matrix[10] * matrix[15] - matrix[14] * matrix[11] };
 				const double e01{ matrix[9] * matrix[15] - matrix[13] * matrix[11] };
 				const double e02{ matrix[9] * matrix[14] - matrix[13] * matrix[10] };
@@ -1189,7 +1582,7 @@ namespace CinMath {
 		template<typename ValueType>
 		struct MatrixInverse<4, 4, ValueType> final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Matrix<4, 4, float>& matrix) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const Matrix<4, 4, float>& matrix) noexcept
 			{
 				/*					   | D11 D12 D13 D14 |
 				*			   1	   | D21 D22 D23 D24 |
@@ -1201,6 +1594,10 @@ namespace CinMath {
 				
 				/* Verify the inverse exists */
 				assert(Determinant(matrix) != 0.0f);
+
+				if (std::is_constant_evaluated())
+					return ConstantEvaluation::Inverse(ConstantEvaluation::Elements(matrix));
+
 				Matrix<4, 4, float> result;
 				const float oneOverDeterminant{ 1.0f / MatrixDeterminant<4, 4, float>::implementation(matrix) };
 				
@@ -1336,7 +1733,7 @@ namespace CinMath {
 				return A_transposed * oneOverDeterminant;
 			}
 
-			CIN_MATH_INLINE static Matrix<4, 4, double> implementation(const Matrix<4, 4, double>& matrix) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, double> implementation(const Matrix<4, 4, double>& matrix) noexcept
 			{
 				/*					   | D11 D12 D13 D14 |
 				*			   1	   | D21 D22 D23 D24 |
@@ -1348,6 +1745,10 @@ namespace CinMath {
 
 				/* Verify the inverse exists */
 				assert(Determinant(matrix) != 0.0f);
+
+				if (std::is_constant_evaluated())
+					return ConstantEvaluation::Inverse(ConstantEvaluation::Elements(matrix));
+
 				Matrix<4, 4, double> result;
 				const double oneOverDeterminant{ 1.0f / MatrixDeterminant<4, 4, double>::implementation(matrix) };
 
@@ -1555,10 +1956,13 @@ namespace CinMath {
 		template<typename ValueType>
 		struct QuaternionRotate final
 		{
-			CIN_MATH_INLINE static TQuaternion<float> implementation(const Vector<3, float>& vector, const TQuaternion<float>& rotation) noexcept
+			CIN_MATH_INLINE static Vector<3, ValueType> implementation(const Vector<3, ValueType>& vector, const TQuaternion<ValueType>& rotation) noexcept
 			{
-				assert(false);
-				return TQuaternion<float>{};
+				/* v' = v + 2w(q x v) + 2q x (q x v), for a unit quaternion (w, q) */
+				const Vector<3, ValueType> axis{ rotation.vector };
+				const Vector<3, ValueType> t{ Cross(axis, vector) * static_cast<ValueType>(2) };
+
+				return vector + t * rotation.scalar + Cross(axis, t);
 			}
 		};
 
@@ -1623,14 +2027,18 @@ namespace CinMath {
 		template<typename ValueType>
 		struct OrthographicProjection final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const ValueType orthoLeft, const ValueType orthoRight, const ValueType orthoBottom, const ValueType orthoTop) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const ValueType orthoLeft, const ValueType orthoRight, const ValueType orthoBottom, const ValueType orthoTop) noexcept
 			{
-				return Matrix<4, 4, float>
+				constexpr ValueType zero{ static_cast<ValueType>(0) };
+				constexpr ValueType one{ static_cast<ValueType>(1) };
+				constexpr ValueType two{ static_cast<ValueType>(2) };
+
+				return Matrix<4, 4, ValueType>
 				{
-					2.0f / (orthoRight - orthoLeft), 0.0f, 0.0f, 0.0f,
-					0.0f, 2.0f / (orthoTop - orthoBottom), 0.0f, 0.0f,
-					0.0f, 0.0f, -1.0f, 0.0f,
-					-(orthoRight + orthoLeft) / (orthoRight - orthoLeft), -(orthoTop + orthoBottom) / (orthoTop - orthoBottom), 0.0f, 1.0f
+					two / (orthoRight - orthoLeft), zero, zero, zero,
+					zero, two / (orthoTop - orthoBottom), zero, zero,
+					zero, zero, -one, zero,
+					-(orthoRight + orthoLeft) / (orthoRight - orthoLeft), -(orthoTop + orthoBottom) / (orthoTop - orthoBottom), zero, one
 				};
 			}
 		};
@@ -1638,20 +2046,131 @@ namespace CinMath {
 		template<typename ValueType>
 		struct PerspectiveProjection final
 		{
-			CIN_MATH_INLINE static Matrix<4, 4, float> implementation(const ValueType FOV, const ValueType aspectRatio, const ValueType nearClip, const ValueType farClip) noexcept
+			constexpr CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const ValueType FOV, const ValueType aspectRatio, const ValueType nearClip, const ValueType farClip) noexcept
 			{
-				Matrix<4, 4, float> result;
+				constexpr ValueType zero{ static_cast<ValueType>(0) };
+				constexpr ValueType one{ static_cast<ValueType>(1) };
+				constexpr ValueType two{ static_cast<ValueType>(2) };
 
-				const float tangentHalfFOV{ std::tan(FOV * 0.5f) };
-				const float nearClipMinusFarClip{ nearClip - farClip };
+				const ValueType tangentHalfFOV{ Tan(FOV * static_cast<ValueType>(0.5)) };
+				const ValueType nearClipMinusFarClip{ nearClip - farClip };
 
-				result[0] = 1.0f / (tangentHalfFOV * aspectRatio);
-				result[5] = 1.0f / (tangentHalfFOV);
-				result[10] = (farClip + nearClip) / nearClipMinusFarClip;
-				result[11] = -1.0f;
-				result[14] = 2.0f * farClip * nearClip / nearClipMinusFarClip;
+				/* Built through the constructor so the result is also a valid constant */
+				return Matrix<4, 4, ValueType>
+				{
+					one / (tangentHalfFOV * aspectRatio), zero, zero, zero,
+					zero, one / tangentHalfFOV, zero, zero,
+					zero, zero, (farClip + nearClip) / nearClipMinusFarClip, -one,
+					zero, zero, two * farClip * nearClip / nearClipMinusFarClip, zero
+				};
+			}
+		};
 
-				return result;
+		template<typename ValueType>
+		struct MatrixDecompose final
+		{
+			/*
+			 * Quaternion of an orthonormal rotation given by its columns, Shepperd's method: the largest of w, x, y and z
+			 * comes from the diagonal and divides the others, so no square root of a near zero value decides the result
+			 */
+			CIN_MATH_INLINE static TQuaternion<ValueType> Rotation(const Vector<3, ValueType>& column0, const Vector<3, ValueType>& column1, const Vector<3, ValueType>& column2) noexcept
+			{
+				constexpr ValueType one{ static_cast<ValueType>(1) };
+				constexpr ValueType half{ static_cast<ValueType>(0.5) };
+
+				/* Rij is row i of column j */
+				const ValueType r00{ column0.x }, r10{ column0.y }, r20{ column0.z };
+				const ValueType r01{ column1.x }, r11{ column1.y }, r21{ column1.z };
+				const ValueType r02{ column2.x }, r12{ column2.y }, r22{ column2.z };
+
+				ValueType diagonal;
+				std::size_t largest;
+				if (r00 + r11 + r22 > static_cast<ValueType>(0))
+				{
+					diagonal = one + r00 + r11 + r22;
+					largest = 0U;
+				}
+				else if (r00 > r11 && r00 > r22)
+				{
+					diagonal = one + r00 - r11 - r22;
+					largest = 1U;
+				}
+				else if (r11 > r22)
+				{
+					diagonal = one - r00 + r11 - r22;
+					largest = 2U;
+				}
+				else
+				{
+					diagonal = one - r00 - r11 + r22;
+					largest = 3U;
+				}
+
+				const ValueType root{ std::sqrt(diagonal) };
+				const ValueType quarter{ half * root };
+				const ValueType inverse{ half / root };
+
+				switch (largest)
+				{
+				case 0U:
+					return TQuaternion<ValueType>{ quarter, (r21 - r12) * inverse, (r02 - r20) * inverse, (r10 - r01) * inverse };
+				case 1U:
+					return TQuaternion<ValueType>{ (r21 - r12) * inverse, quarter, (r01 + r10) * inverse, (r02 + r20) * inverse };
+				case 2U:
+					return TQuaternion<ValueType>{ (r02 - r20) * inverse, (r01 + r10) * inverse, quarter, (r12 + r21) * inverse };
+				default:
+					return TQuaternion<ValueType>{ (r10 - r01) * inverse, (r02 + r20) * inverse, (r12 + r21) * inverse, quarter };
+				}
+			}
+
+			CIN_MATH_INLINE static void implementation(const Matrix<4, 4, ValueType>& matrix, Vector<3, ValueType>& translation, TQuaternion<ValueType>& rotation, Vector<3, ValueType>& scale) noexcept
+			{
+				const Vector<3, ValueType> column0{ matrix.raw[0], matrix.raw[1], matrix.raw[2] };
+				const Vector<3, ValueType> column1{ matrix.raw[4], matrix.raw[5], matrix.raw[6] };
+				const Vector<3, ValueType> column2{ matrix.raw[8], matrix.raw[9], matrix.raw[10] };
+
+				translation = Vector<3, ValueType>{ matrix.raw[12], matrix.raw[13], matrix.raw[14] };
+				scale = Vector<3, ValueType>{ Length(column0), Length(column1), Length(column2) };
+
+				/* A mirroring matrix has a negative determinant, folded into the x scale to keep the rotation proper */
+				if (Dot(Cross(column0, column1), column2) < static_cast<ValueType>(0))
+					scale.x = -scale.x;
+
+				rotation = Rotation(column0 / scale.x, column1 / scale.y, column2 / scale.z);
+			}
+
+			CIN_MATH_INLINE static void implementation(const Matrix<4, 4, ValueType>& matrix, Vector<3, ValueType>& translation, TQuaternion<ValueType>& rotation) noexcept
+			{
+				translation = Vector<3, ValueType>{ matrix.raw[12], matrix.raw[13], matrix.raw[14] };
+				rotation = Rotation(
+					Vector<3, ValueType>{ matrix.raw[0], matrix.raw[1], matrix.raw[2] },
+					Vector<3, ValueType>{ matrix.raw[4], matrix.raw[5], matrix.raw[6] },
+					Vector<3, ValueType>{ matrix.raw[8], matrix.raw[9], matrix.raw[10] });
+			}
+		};
+
+		template<typename ValueType>
+		struct MatrixCompose final
+		{
+			CIN_MATH_INLINE static Matrix<4, 4, ValueType> implementation(const Vector<3, ValueType>& translation, const TQuaternion<ValueType>& rotation, const Vector<3, ValueType>& scale) noexcept
+			{
+				constexpr ValueType zero{ static_cast<ValueType>(0) };
+				constexpr ValueType one{ static_cast<ValueType>(1) };
+				constexpr ValueType two{ static_cast<ValueType>(2) };
+
+				const ValueType w{ rotation.scalar };
+				const ValueType x{ rotation.vector.x };
+				const ValueType y{ rotation.vector.y };
+				const ValueType z{ rotation.vector.z };
+
+				/* Columns of the rotation matrix scaled by the scale components, translation in the last column */
+				return Matrix<4, 4, ValueType>
+				{
+					(one - two * (y * y + z * z)) * scale.x, two * (x * y + w * z) * scale.x, two * (x * z - w * y) * scale.x, zero,
+					two * (x * y - w * z) * scale.y, (one - two * (x * x + z * z)) * scale.y, two * (y * z + w * x) * scale.y, zero,
+					two * (x * z + w * y) * scale.z, two * (y * z - w * x) * scale.z, (one - two * (x * x + y * y)) * scale.z, zero,
+					translation.x, translation.y, translation.z, one
+				};
 			}
 		};
 	}
@@ -1668,6 +2187,12 @@ namespace CinMath {
 		return Implementation::VectorNormalize<length, ValueType>::implementation(vector);
 	}
 
+	template<Length_t length, typename ValueType>
+	CIN_MATH_INLINE Vector<length, ValueType> NormalizeFast(const Vector<length, ValueType>& vector) noexcept
+	{
+		return Implementation::VectorNormalizeFast<length, ValueType>::implementation(vector);
+	}
+
 	template<Length_t length, typename ValueType>
 	CIN_MATH_INLINE ValueType Dot(const Vector<length, ValueType>& lhs, const Vector<length, ValueType>& rhs) noexcept
 	{
@@ -1687,13 +2212,13 @@ namespace CinMath {
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE ValueType Determinant(const Matrix<rows, columns, ValueType>& matrix) noexcept
+	constexpr CIN_MATH_INLINE ValueType Determinant(const Matrix<rows, columns, ValueType>& matrix) noexcept
 	{
 		return Implementation::MatrixDeterminant<rows, columns, ValueType>::implementation(matrix);
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> Inverse(const Matrix<rows, columns, ValueType>& matrix) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> Inverse(const Matrix<rows, columns, ValueType>& matrix) noexcept
 	{
 		return Implementation::MatrixInverse<rows, columns, ValueType>::implementation(matrix);
 	}
@@ -1753,25 +2278,25 @@ namespace CinMath {
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> Translate(const Matrix<rows, columns, ValueType>& matrix, const Vector<3, ValueType>& translation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> Translate(const Matrix<rows, columns, ValueType>& matrix, const Vector<3, ValueType>& translation) noexcept
 	{
 		return Implementation::MatrixTranslate<rows, columns, ValueType>::implementation(matrix, translation);
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> Translate(const Matrix<rows, columns, ValueType>& matrix, const Vector<4, ValueType>& translation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> Translate(const Matrix<rows, columns, ValueType>& matrix, const Vector<4, ValueType>& translation) noexcept
 	{
 		return Implementation::MatrixTranslate<rows, columns, ValueType>::implementation(matrix, translation);
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> TranslateIdentity(const Vector<3, ValueType>& translation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> TranslateIdentity(const Vector<3, ValueType>& translation) noexcept
 	{
 		return Implementation::MatrixTranslateIdentity<rows, columns, ValueType>::implementation(translation);
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> TranslateIdentity(const Vector<4, ValueType>& translation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> TranslateIdentity(const Vector<4, ValueType>& translation) noexcept
 	{
 		return Implementation::MatrixTranslateIdentity<rows, columns, ValueType>::implementation(translation);
 	}
@@ -1795,37 +2320,37 @@ namespace CinMath {
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateX(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateX(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept
 	{
 		return Implementation::MatrixRotateX<rows, columns, ValueType>::implementation(matrix, rotation.ToRadians());
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateXIdentity(const TAngle<ValueType> rotation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateXIdentity(const TAngle<ValueType> rotation) noexcept
 	{
 		return Implementation::MatrixRotateXIdentity<rows, columns, ValueType>::implementation(rotation.ToRadians());
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateY(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateY(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept
 	{
 		return Implementation::MatrixRotateY<rows, columns, ValueType>::implementation(matrix, rotation.ToRadians());
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateYIdentity(const TAngle<ValueType> rotation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateYIdentity(const TAngle<ValueType> rotation) noexcept
 	{
 		return Implementation::MatrixRotateYIdentity<rows, columns, ValueType>::implementation(rotation.ToRadians());
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateZ(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateZ(const Matrix<rows, columns, ValueType>& matrix, const TAngle<ValueType> rotation) noexcept
 	{
-		return Implementation::MatrixRotateZ<rows, columns, ValueType>::implementation(rotation.ToRadians());
+		return Implementation::MatrixRotateZ<rows, columns, ValueType>::implementation(matrix, rotation.ToRadians());
 	}
 
 	template<Length_t rows, Length_t columns, typename ValueType>
-	CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateZIdentity(const TAngle<ValueType> rotation) noexcept
+	constexpr CIN_MATH_INLINE Matrix<rows, columns, ValueType> RotateZIdentity(const TAngle<ValueType> rotation) noexcept
 	{
 		return Implementation::MatrixRotateZIdentity<rows, columns, ValueType>::implementation(rotation.ToRadians());
 	}
@@ -1837,14 +2362,32 @@ namespace CinMath {
 	}
 
 	template<typename ValueType>
-	CIN_MATH_INLINE Matrix<4, 4, ValueType> OrthographicProjection(const ValueType orthoLeft, const ValueType orthoRight, const ValueType orthoBottom, const ValueType orthoTop) noexcept
+	constexpr CIN_MATH_INLINE Matrix<4, 4, ValueType> OrthographicProjection(const ValueType orthoLeft, const ValueType orthoRight, const ValueType orthoBottom, const ValueType orthoTop) noexcept
 	{
 		return Implementation::OrthographicProjection<ValueType>::implementation(orthoLeft, orthoRight, orthoBottom, orthoTop);
 	}
 
 	template<typename ValueType>
-	CIN_MATH_INLINE Matrix<4, 4, ValueType> PerspectiveProjection(const ValueType FOV, const ValueType aspectRatio, const ValueType nearClip, const ValueType farClip) noexcept
+	constexpr CIN_MATH_INLINE Matrix<4, 4, ValueType> PerspectiveProjection(const ValueType FOV, const ValueType aspectRatio, const ValueType nearClip, const ValueType farClip) noexcept
 	{
 		return Implementation::PerspectiveProjection<ValueType>::implementation(FOV, aspectRatio, nearClip, farClip);
 	}
-}
\ No newline at end of file
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void Decompose(const Matrix<4, 4, ValueType>& matrix, Vector<3, ValueType>& translation, TQuaternion<ValueType>& rotation, Vector<3, ValueType>& scale) noexcept
+	{
+		Implementation::MatrixDecompose<ValueType>::implementation(matrix, translation, rotation, scale);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE void DecomposeOrthonormal(const Matrix<4, 4, ValueType>& matrix, Vector<3, ValueType>& translation, TQuaternion<ValueType>& rotation) noexcept
+	{
+		Implementation::MatrixDecompose<ValueType>::implementation(matrix, translation, rotation);
+	}
+
+	template<typename ValueType>
+	CIN_MATH_INLINE Matrix<4, 4, ValueType> Compose(const Vector<3, ValueType>& translation, const TQuaternion<ValueType>& rotation, const Vector<3, ValueType>& scale) noexcept
+	{
+		return Implementation::MatrixCompose<ValueType>::implementation(translation, rotation, scale);
+	}
+}
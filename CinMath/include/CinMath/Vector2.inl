@@ -152,138 +152,188 @@ namespace CinMath {
 	CIN_MATH_INLINE Vector<2, double> CIN_MATH_CALL operator-(const Vector<2, double>& vector) noexcept
 	{
 		Vector<2, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		result.data = _mm_xor_pd(vector.data, _mm_set1_pd(-0.0));
+#else
 		result.raw[0] = -vector.raw[0];
 		result.raw[1] = -vector.raw[1];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator+=(Vector<2, double>& lhs, const Vector<2, double>& rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		lhs.data = _mm_add_pd(lhs.data, rhs.data);
+#else
 		lhs.raw[0] += rhs.raw[0];
 		lhs.raw[1] += rhs.raw[1];
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator-=(Vector<2, double>& lhs, const Vector<2, double>& rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		lhs.data = _mm_sub_pd(lhs.data, rhs.data);
+#else
 		lhs.raw[0] -= rhs.raw[0];
 		lhs.raw[1] -= rhs.raw[1];
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator*=(Vector<2, double>& lhs, const Vector<2, double>& rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		lhs.data = _mm_mul_pd(lhs.data, rhs.data);
+#else
 		lhs.raw[0] *= rhs.raw[0];
 		lhs.raw[1] *= rhs.raw[1];
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator/=(Vector<2, double>& lhs, const Vector<2, double>& rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		lhs.data = _mm_div_pd(lhs.data, rhs.data);
+#else
 		lhs.raw[0] /= rhs.raw[0];
 		lhs.raw[1] /= rhs.raw[1];
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator+=(Vector<2, double>& lhs, const double rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		lhs.data = _mm_add_pd(lhs.data, _mm_set1_pd(rhs));
+#else
 		lhs.raw[0] += rhs;
 		lhs.raw[1] += rhs;
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator-=(Vector<2, double>& lhs, const double rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		lhs.data = _mm_sub_pd(lhs.data, _mm_set1_pd(rhs));
+#else
 		lhs.raw[0] -= rhs;
 		lhs.raw[1] -= rhs;
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator*=(Vector<2, double>& lhs, const double rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		lhs.data = _mm_mul_pd(lhs.data, _mm_set1_pd(rhs));
+#else
 		lhs.raw[0] *= rhs;
 		lhs.raw[1] *= rhs;
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator/=(Vector<2, double>& lhs, const double rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		lhs.data = _mm_div_pd(lhs.data, _mm_set1_pd(rhs));
+#else
 		lhs.raw[0] /= rhs;
 		lhs.raw[1] /= rhs;
+#endif
 	}
 
 	CIN_MATH_INLINE Vector<2, double> CIN_MATH_CALL operator+(const Vector<2, double>& lhs, const Vector<2, double>& rhs) noexcept
 	{
 		Vector<2, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		result.data = _mm_add_pd(lhs.data, rhs.data);
+#else
 		result.raw[0] = lhs.raw[0] + rhs.raw[0];
 		result.raw[1] = lhs.raw[1] + rhs.raw[1];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<2, double> CIN_MATH_CALL operator-(const Vector<2, double>& lhs, const Vector<2, double>& rhs) noexcept
 	{
 		Vector<2, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		result.data = _mm_sub_pd(lhs.data, rhs.data);
+#else
 		result.raw[0] = lhs.raw[0] - rhs.raw[0];
 		result.raw[1] = lhs.raw[1] - rhs.raw[1];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<2, double> CIN_MATH_CALL operator*(const Vector<2, double>& lhs, const Vector<2, double>& rhs) noexcept
 	{
 		Vector<2, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		result.data = _mm_mul_pd(lhs.data, rhs.data);
+#else
 		result.raw[0] = lhs.raw[0] * rhs.raw[0];
 		result.raw[1] = lhs.raw[1] * rhs.raw[1];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<2, double> CIN_MATH_CALL operator/(const Vector<2, double>& lhs, const Vector<2, double>& rhs) noexcept
 	{
 		Vector<2, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		result.data = _mm_div_pd(lhs.data, rhs.data);
+#else
 		result.raw[0] = lhs.raw[0] / rhs.raw[0];
 		result.raw[1] = lhs.raw[1] / rhs.raw[1];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<2, double> CIN_MATH_CALL operator+(const Vector<2, double>& lhs, const double rhs) noexcept
 	{
 		Vector<2, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		result.data = _mm_add_pd(lhs.data, _mm_set1_pd(rhs));
+#else
 		result.raw[0] = lhs.raw[0] + rhs;
 		result.raw[1] = lhs.raw[1] + rhs;
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<2, double> CIN_MATH_CALL operator-(const Vector<2, double>& lhs, const double rhs) noexcept
 	{
 		Vector<2, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		result.data = _mm_sub_pd(lhs.data, _mm_set1_pd(rhs));
+#else
 		result.raw[0] = lhs.raw[0] - rhs;
 		result.raw[1] = lhs.raw[1] - rhs;
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<2, double> CIN_MATH_CALL operator*(const Vector<2, double>& lhs, const double rhs) noexcept
 	{
 		Vector<2, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		result.data = _mm_mul_pd(lhs.data, _mm_set1_pd(rhs));
+#else
 		result.raw[0] = lhs.raw[0] * rhs;
 		result.raw[1] = lhs.raw[1] * rhs;
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<2, double> CIN_MATH_CALL operator/(const Vector<2, double>& lhs, const double rhs) noexcept
 	{
 		Vector<2, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE2_BIT)
+		result.data = _mm_div_pd(lhs.data, _mm_set1_pd(rhs));
+#else
 		result.raw[0] = lhs.raw[0] / rhs;
 		result.raw[1] = lhs.raw[1] / rhs;
-
+#endif
 		return result;
 	}
 }
\ No newline at end of file
@@ -123,7 +123,7 @@ namespace CinMath {
 				ValueType r, g, b, a;
 			};
 
-			/* 2-Element swizzle */
+			/* 2-Element swizzle, element-wise (see Vector2Swizzle) */
 			Vector2Swizzle<ValueType, Vector<2, ValueType>, 0, 1> xy;
 			Vector2Swizzle<ValueType, Vector<2, ValueType>, 0, 2> xz;
 			Vector2Swizzle<ValueType, Vector<2, ValueType>, 0, 3> xw;
@@ -133,12 +133,31 @@ namespace CinMath {
 
 			Vector2Swizzle<ValueType, Vector<2, ValueType>, 2, 3> zw;
 
-			/* 3-Element swizzle */
+			/* 3-Element swizzle, element-wise (see Vector2Swizzle) */
 			Vector3Swizzle<ValueType, Vector<3, ValueType>, 0, 1, 2> xyz;
 			Vector3Swizzle<ValueType, Vector<3, ValueType>, 1, 2, 3> yzw;
 
-			/* 4-Element swizzle */
+			/* 4-Element swizzle, one shuffle for float */
 			Vector4Swizzle<ValueType, Vector<4, ValueType>, 0, 1, 2, 3> xyzw;
+
+			/* Broadcasts */
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 0, 0, 0, 0> xxxx;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 1, 1, 1, 1> yyyy;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 2, 2, 2, 2> zzzz;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 3, 3, 3, 3> wwww;
+
+			/* Permutations */
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 3, 2, 1, 0> wzyx;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 2, 3, 0, 1> zwxy;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 1, 0, 3, 2> yxwz;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 1, 2, 0, 3> yzxw;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 2, 0, 1, 3> zxyw;
+
+			/* Duplications */
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 0, 0, 1, 1> xxyy;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 2, 2, 3, 3> zzww;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 0, 1, 0, 1> xyxy;
+			Vector4Swizzle<ValueType, Vector<4, ValueType>, 2, 3, 2, 3> zwzw;
 		};
 	};
 
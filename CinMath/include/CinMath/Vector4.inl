@@ -1,6 +1,41 @@
 #pragma once
 
 namespace CinMath {
+	namespace Implementation {
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		/* Sum of the lanes, (x + y) + (z + w), broadcast to every lane */
+		CIN_MATH_INLINE __m128 CIN_MATH_CALL SumBroadcast(const __m128 value) noexcept
+		{
+			/* (x, y, z, w) + (y, x, w, z), then + the other half */
+			const __m128 pairs{ _mm_add_ps(value, _mm_shuffle_ps(value, value, 0b10'11'00'01)) };
+			return _mm_add_ps(pairs, _mm_shuffle_ps(pairs, pairs, 0b01'00'11'10));
+		}
+
+		/*
+		 * 1 / sqrt(value), estimate refined by one Newton-Raphson step: y' = y * (1.5 - 0.5 * x * y * y). The estimate
+		 * of zero (infinity) and of infinity (zero) is exact, the refinement would turn it into 0 * infinity
+		 */
+		CIN_MATH_INLINE __m128 CIN_MATH_CALL ReciprocalSqrt(const __m128 value) noexcept
+		{
+			const __m128 estimate{ _mm_rsqrt_ps(value) };
+			const __m128 halfValue{ _mm_mul_ps(value, _mm_set1_ps(0.5f)) };
+			const __m128 refined{ _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfValue, _mm_mul_ps(estimate, estimate)))) };
+			const __m128 exact{ _mm_or_ps(_mm_cmpeq_ps(value, _mm_setzero_ps()), _mm_cmpeq_ps(value, _mm_set1_ps(std::numeric_limits<float>::infinity()))) };
+			return _mm_or_ps(_mm_and_ps(exact, estimate), _mm_andnot_ps(exact, refined));
+		}
+#endif
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		CIN_MATH_INLINE __m256 CIN_MATH_CALL ReciprocalSqrt(const __m256 value) noexcept
+		{
+			const __m256 estimate{ _mm256_rsqrt_ps(value) };
+			const __m256 halfValue{ _mm256_mul_ps(value, _mm256_set1_ps(0.5f)) };
+			const __m256 refined{ _mm256_mul_ps(estimate, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfValue, _mm256_mul_ps(estimate, estimate)))) };
+			const __m256 exact{ _mm256_or_ps(_mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_EQ_OQ), _mm256_cmp_ps(value, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ)) };
+			return _mm256_blendv_ps(refined, estimate, exact);
+		}
+#endif
+	}
+
 	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL operator+(const Vector<4, float>& vector) noexcept
 	{
 		return vector;
@@ -277,183 +312,996 @@ namespace CinMath {
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator-(const Vector<4, double>& vector) noexcept
 	{
 		Vector<4, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_xor_pd(vector.data, _mm256_set1_pd(-0.0));
+#else
 		result.raw[0] = -vector.raw[0];
 		result.raw[1] = -vector.raw[1];
 		result.raw[2] = -vector.raw[2];
 		result.raw[3] = -vector.raw[3];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator+=(Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		lhs.data = _mm256_add_pd(lhs.data, rhs.data);
+#else
 		lhs.raw[0] += rhs.raw[0];
 		lhs.raw[1] += rhs.raw[1];
 		lhs.raw[2] += rhs.raw[2];
 		lhs.raw[3] += rhs.raw[3];
+#endif
 	}
+
 	CIN_MATH_INLINE void CIN_MATH_CALL operator-=(Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		lhs.data = _mm256_sub_pd(lhs.data, rhs.data);
+#else
 		lhs.raw[0] -= rhs.raw[0];
 		lhs.raw[1] -= rhs.raw[1];
 		lhs.raw[2] -= rhs.raw[2];
 		lhs.raw[3] -= rhs.raw[3];
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator*=(Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		lhs.data = _mm256_mul_pd(lhs.data, rhs.data);
+#else
 		lhs.raw[0] *= rhs.raw[0];
 		lhs.raw[1] *= rhs.raw[1];
 		lhs.raw[2] *= rhs.raw[2];
 		lhs.raw[3] *= rhs.raw[3];
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator/=(Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		lhs.data = _mm256_div_pd(lhs.data, rhs.data);
+#else
 		lhs.raw[0] /= rhs.raw[0];
 		lhs.raw[1] /= rhs.raw[1];
 		lhs.raw[2] /= rhs.raw[2];
 		lhs.raw[3] /= rhs.raw[3];
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator+=(Vector<4, double>& lhs, const double rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		lhs.data = _mm256_add_pd(lhs.data, _mm256_set1_pd(rhs));
+#else
 		lhs.raw[0] += rhs;
 		lhs.raw[1] += rhs;
 		lhs.raw[2] += rhs;
 		lhs.raw[3] += rhs;
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator-=(Vector<4, double>& lhs, const double rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		lhs.data = _mm256_sub_pd(lhs.data, _mm256_set1_pd(rhs));
+#else
 		lhs.raw[0] -= rhs;
 		lhs.raw[1] -= rhs;
 		lhs.raw[2] -= rhs;
 		lhs.raw[3] -= rhs;
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator*=(Vector<4, double>& lhs, const double rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		lhs.data = _mm256_mul_pd(lhs.data, _mm256_set1_pd(rhs));
+#else
 		lhs.raw[0] *= rhs;
 		lhs.raw[1] *= rhs;
 		lhs.raw[2] *= rhs;
 		lhs.raw[3] *= rhs;
+#endif
 	}
 
 	CIN_MATH_INLINE void CIN_MATH_CALL operator/=(Vector<4, double>& lhs, const double rhs) noexcept
 	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		lhs.data = _mm256_div_pd(lhs.data, _mm256_set1_pd(rhs));
+#else
 		lhs.raw[0] /= rhs;
 		lhs.raw[1] /= rhs;
 		lhs.raw[2] /= rhs;
 		lhs.raw[3] /= rhs;
+#endif
 	}
 
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator+(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
 	{
 		Vector<4, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_add_pd(lhs.data, rhs.data);
+#else
 		result.raw[0] = lhs.raw[0] + rhs.raw[0];
 		result.raw[1] = lhs.raw[1] + rhs.raw[1];
 		result.raw[2] = lhs.raw[2] + rhs.raw[2];
 		result.raw[3] = lhs.raw[3] + rhs.raw[3];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator-(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
 	{
 		Vector<4, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_sub_pd(lhs.data, rhs.data);
+#else
 		result.raw[0] = lhs.raw[0] - rhs.raw[0];
 		result.raw[1] = lhs.raw[1] - rhs.raw[1];
 		result.raw[2] = lhs.raw[2] - rhs.raw[2];
 		result.raw[3] = lhs.raw[3] - rhs.raw[3];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator*(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
 	{
 		Vector<4, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_mul_pd(lhs.data, rhs.data);
+#else
 		result.raw[0] = lhs.raw[0] * rhs.raw[0];
 		result.raw[1] = lhs.raw[1] * rhs.raw[1];
 		result.raw[2] = lhs.raw[2] * rhs.raw[2];
 		result.raw[3] = lhs.raw[3] * rhs.raw[3];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator/(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
 	{
 		Vector<4, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_div_pd(lhs.data, rhs.data);
+#else
 		result.raw[0] = lhs.raw[0] / rhs.raw[0];
 		result.raw[1] = lhs.raw[1] / rhs.raw[1];
 		result.raw[2] = lhs.raw[2] / rhs.raw[2];
 		result.raw[3] = lhs.raw[3] / rhs.raw[3];
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator+(const Vector<4, double>& lhs, const double rhs) noexcept
 	{
 		Vector<4, double> result;
-		
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_add_pd(lhs.data, _mm256_set1_pd(rhs));
+#else
 		result.raw[0] = lhs.raw[0] + rhs;
 		result.raw[1] = lhs.raw[1] + rhs;
 		result.raw[2] = lhs.raw[2] + rhs;
 		result.raw[3] = lhs.raw[3] + rhs;
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator-(const Vector<4, double>& lhs, const double rhs) noexcept
 	{
 		Vector<4, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_sub_pd(lhs.data, _mm256_set1_pd(rhs));
+#else
 		result.raw[0] = lhs.raw[0] - rhs;
 		result.raw[1] = lhs.raw[1] - rhs;
 		result.raw[2] = lhs.raw[2] - rhs;
 		result.raw[3] = lhs.raw[3] - rhs;
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator*(const Vector<4, double>& lhs, const double rhs) noexcept
 	{
 		Vector<4, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_mul_pd(lhs.data, _mm256_set1_pd(rhs));
+#else
 		result.raw[0] = lhs.raw[0] * rhs;
 		result.raw[1] = lhs.raw[1] * rhs;
 		result.raw[2] = lhs.raw[2] * rhs;
 		result.raw[3] = lhs.raw[3] * rhs;
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator/(const Vector<4, double>& lhs, const double rhs) noexcept
 	{
 		Vector<4, double> result;
-
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm256_div_pd(lhs.data, _mm256_set1_pd(rhs));
+#else
 		result.raw[0] = lhs.raw[0] / rhs;
 		result.raw[1] = lhs.raw[1] / rhs;
 		result.raw[2] = lhs.raw[2] / rhs;
 		result.raw[3] = lhs.raw[3] / rhs;
-
+#endif
 		return result;
 	}
 
 	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL operator*(const Vector<4, double>& lhs, const Matrix<4, 4, double>& rhs) noexcept
 	{
 		Vector<4, double> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		/* Row products, then pairwise sums: (r0, r1) and (r2, r3) halves are added across the 128 bit lanes */
+		const __m256d m0{ _mm256_mul_pd(lhs.data, _mm256_loadu_pd(rhs.raw + 0)) };
+		const __m256d m1{ _mm256_mul_pd(lhs.data, _mm256_loadu_pd(rhs.raw + 4)) };
+		const __m256d m2{ _mm256_mul_pd(lhs.data, _mm256_loadu_pd(rhs.raw + 8)) };
+		const __m256d m3{ _mm256_mul_pd(lhs.data, _mm256_loadu_pd(rhs.raw + 12)) };
 
+		const __m256d h0{ _mm256_hadd_pd(m0, m1) };
+		const __m256d h1{ _mm256_hadd_pd(m2, m3) };
+		result.data = _mm256_add_pd(_mm256_permute2f128_pd(h0, h1, 0x20), _mm256_permute2f128_pd(h0, h1, 0x31));
+#else
 		result.raw[0] = lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2] + lhs[3] * rhs[3];
 		result.raw[1] = lhs[0] * rhs[4] + lhs[1] * rhs[5] + lhs[2] * rhs[6] + lhs[3] * rhs[7];
 		result.raw[2] = lhs[0] * rhs[8] + lhs[1] * rhs[9] + lhs[2] * rhs[10] + lhs[3] * rhs[11];
 		result.raw[3] = lhs[0] * rhs[12] + lhs[1] * rhs[13] + lhs[2] * rhs[14] + lhs[3] * rhs[15];
-		
+#endif
+		return result;
+	}
+
+	/**
+	 * Reorders the components of a vector, result = (v[X], v[Y], v[Z], v[W])
+	 * 
+	 * @param input vector
+	 * @return swizzled vector
+	 */
+	template<std::size_t X, std::size_t Y, std::size_t Z, std::size_t W>
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Swizzle(const Vector<4, float>& vector) noexcept
+	{
+		static_assert(X < 4U && Y < 4U && Z < 4U && W < 4U, "Swizzle index out of range");
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_AVX_BIT)
+		result.data = _mm_permute_ps(vector.data, _MM_SHUFFLE(W, Z, Y, X));
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_shuffle_ps(vector.data, vector.data, _MM_SHUFFLE(W, Z, Y, X));
+#else
+		result.raw[0] = vector.raw[X];
+		result.raw[1] = vector.raw[Y];
+		result.raw[2] = vector.raw[Z];
+		result.raw[3] = vector.raw[W];
+#endif
+		return result;
+	}
+
+	template<std::size_t X, std::size_t Y, std::size_t Z, std::size_t W>
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Swizzle(const Vector<4, double>& vector) noexcept
+	{
+		static_assert(X < 4U && Y < 4U && Z < 4U && W < 4U, "Swizzle index out of range");
+		return Vector<4, double>{ vector.raw[X], vector.raw[Y], vector.raw[Z], vector.raw[W] };
+	}
+
+	/**
+	 * Combines two vectors, result = (lhs[X], lhs[Y], rhs[Z], rhs[W])
+	 * 
+	 * @param input vector providing x and y
+	 * @param input vector providing z and w
+	 * @return shuffled vector
+	 */
+	template<std::size_t X, std::size_t Y, std::size_t Z, std::size_t W>
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Shuffle(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+	{
+		static_assert(X < 4U && Y < 4U && Z < 4U && W < 4U, "Shuffle index out of range");
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_shuffle_ps(lhs.data, rhs.data, _MM_SHUFFLE(W, Z, Y, X));
+#else
+		result.raw[0] = lhs.raw[X];
+		result.raw[1] = lhs.raw[Y];
+		result.raw[2] = rhs.raw[Z];
+		result.raw[3] = rhs.raw[W];
+#endif
+		return result;
+	}
+
+	template<std::size_t X, std::size_t Y, std::size_t Z, std::size_t W>
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Shuffle(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+	{
+		static_assert(X < 4U && Y < 4U && Z < 4U && W < 4U, "Shuffle index out of range");
+		return Vector<4, double>{ lhs.raw[X], lhs.raw[Y], rhs.raw[Z], rhs.raw[W] };
+	}
+
+	/**
+	 * Selects components at compile time, a component is taken from rhs when its flag is set and from lhs otherwise
+	 * 
+	 * @param input vector providing the unselected components
+	 * @param input vector providing the selected components
+	 * @return blended vector
+	 */
+	template<bool X, bool Y, bool Z, bool W>
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Blend(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE41_BIT)
+		result.data = _mm_blend_ps(lhs.data, rhs.data, (X ? 0b0001 : 0) | (Y ? 0b0010 : 0) | (Z ? 0b0100 : 0) | (W ? 0b1000 : 0));
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		constexpr float selected{ std::bit_cast<float>(0xFFFF'FFFFU) };
+		const __m128 mask{ _mm_setr_ps(X ? selected : 0.0f, Y ? selected : 0.0f, Z ? selected : 0.0f, W ? selected : 0.0f) };
+		result.data = _mm_or_ps(_mm_and_ps(mask, rhs.data), _mm_andnot_ps(mask, lhs.data));
+#else
+		result.raw[0] = X ? rhs.raw[0] : lhs.raw[0];
+		result.raw[1] = Y ? rhs.raw[1] : lhs.raw[1];
+		result.raw[2] = Z ? rhs.raw[2] : lhs.raw[2];
+		result.raw[3] = W ? rhs.raw[3] : lhs.raw[3];
+#endif
+		return result;
+	}
+
+	template<bool X, bool Y, bool Z, bool W>
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Blend(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+	{
+		return Vector<4, double>
+		{
+			X ? rhs.raw[0] : lhs.raw[0],
+			Y ? rhs.raw[1] : lhs.raw[1],
+			Z ? rhs.raw[2] : lhs.raw[2],
+			W ? rhs.raw[3] : lhs.raw[3]
+		};
+	}
+
+	/**
+	 * Component-wise minimum. Like _mm_min_ps, rhs is returned when either component is NaN
+	 * 
+	 * @param input lhs vector
+	 * @param input rhs vector
+	 * @return component-wise result
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Min(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_min_ps(lhs.data, rhs.data);
+#else
+		result.raw[0] = lhs.raw[0] < rhs.raw[0] ? lhs.raw[0] : rhs.raw[0];
+		result.raw[1] = lhs.raw[1] < rhs.raw[1] ? lhs.raw[1] : rhs.raw[1];
+		result.raw[2] = lhs.raw[2] < rhs.raw[2] ? lhs.raw[2] : rhs.raw[2];
+		result.raw[3] = lhs.raw[3] < rhs.raw[3] ? lhs.raw[3] : rhs.raw[3];
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Min(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = lhs.raw[0] < rhs.raw[0] ? lhs.raw[0] : rhs.raw[0];
+		result.raw[1] = lhs.raw[1] < rhs.raw[1] ? lhs.raw[1] : rhs.raw[1];
+		result.raw[2] = lhs.raw[2] < rhs.raw[2] ? lhs.raw[2] : rhs.raw[2];
+		result.raw[3] = lhs.raw[3] < rhs.raw[3] ? lhs.raw[3] : rhs.raw[3];
+
+		return result;
+	}
+
+	/**
+	 * Component-wise maximum. Like _mm_max_ps, rhs is returned when either component is NaN
+	 * 
+	 * @param input lhs vector
+	 * @param input rhs vector
+	 * @return component-wise result
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Max(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_max_ps(lhs.data, rhs.data);
+#else
+		result.raw[0] = lhs.raw[0] > rhs.raw[0] ? lhs.raw[0] : rhs.raw[0];
+		result.raw[1] = lhs.raw[1] > rhs.raw[1] ? lhs.raw[1] : rhs.raw[1];
+		result.raw[2] = lhs.raw[2] > rhs.raw[2] ? lhs.raw[2] : rhs.raw[2];
+		result.raw[3] = lhs.raw[3] > rhs.raw[3] ? lhs.raw[3] : rhs.raw[3];
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Max(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = lhs.raw[0] > rhs.raw[0] ? lhs.raw[0] : rhs.raw[0];
+		result.raw[1] = lhs.raw[1] > rhs.raw[1] ? lhs.raw[1] : rhs.raw[1];
+		result.raw[2] = lhs.raw[2] > rhs.raw[2] ? lhs.raw[2] : rhs.raw[2];
+		result.raw[3] = lhs.raw[3] > rhs.raw[3] ? lhs.raw[3] : rhs.raw[3];
+
+		return result;
+	}
+
+	/**
+	 * Component-wise absolute value
+	 * 
+	 * @param input vector
+	 * @return component-wise result
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Abs(const Vector<4, float>& vector) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_andnot_ps(_mm_set1_ps(-0.0f), vector.data);
+#else
+		result.raw[0] = std::fabs(vector.raw[0]);
+		result.raw[1] = std::fabs(vector.raw[1]);
+		result.raw[2] = std::fabs(vector.raw[2]);
+		result.raw[3] = std::fabs(vector.raw[3]);
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Abs(const Vector<4, double>& vector) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = std::fabs(vector.raw[0]);
+		result.raw[1] = std::fabs(vector.raw[1]);
+		result.raw[2] = std::fabs(vector.raw[2]);
+		result.raw[3] = std::fabs(vector.raw[3]);
+
+		return result;
+	}
+
+	/**
+	 * Clamps every component to [minimum, maximum]
+	 * 
+	 * @param input vector
+	 * @param input lower bounds
+	 * @param input upper bounds
+	 * @return clamped vector
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Clamp(const Vector<4, float>& vector, const Vector<4, float>& minimum, const Vector<4, float>& maximum) noexcept
+	{
+		return Min(Max(vector, minimum), maximum);
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Clamp(const Vector<4, double>& vector, const Vector<4, double>& minimum, const Vector<4, double>& maximum) noexcept
+	{
+		return Min(Max(vector, minimum), maximum);
+	}
+
+	/**
+	 * Linear interpolation, lhs + (rhs - lhs) * t
+	 * 
+	 * @param input vector at t = 0
+	 * @param input vector at t = 1
+	 * @param input interpolation factor
+	 * @return interpolated vector
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Lerp(const Vector<4, float>& lhs, const Vector<4, float>& rhs, const float t) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_add_ps(lhs.data, _mm_mul_ps(_mm_sub_ps(rhs.data, lhs.data), _mm_set1_ps(t)));
+#else
+		result.raw[0] = lhs.raw[0] + (rhs.raw[0] - lhs.raw[0]) * t;
+		result.raw[1] = lhs.raw[1] + (rhs.raw[1] - lhs.raw[1]) * t;
+		result.raw[2] = lhs.raw[2] + (rhs.raw[2] - lhs.raw[2]) * t;
+		result.raw[3] = lhs.raw[3] + (rhs.raw[3] - lhs.raw[3]) * t;
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Lerp(const Vector<4, double>& lhs, const Vector<4, double>& rhs, const double t) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = lhs.raw[0] + (rhs.raw[0] - lhs.raw[0]) * t;
+		result.raw[1] = lhs.raw[1] + (rhs.raw[1] - lhs.raw[1]) * t;
+		result.raw[2] = lhs.raw[2] + (rhs.raw[2] - lhs.raw[2]) * t;
+		result.raw[3] = lhs.raw[3] + (rhs.raw[3] - lhs.raw[3]) * t;
+
+		return result;
+	}
+
+	/**
+	 * Linear interpolation with a factor per component, lhs + (rhs - lhs) * t
+	 * 
+	 * @param input vector at t = 0
+	 * @param input vector at t = 1
+	 * @param input interpolation factors
+	 * @return interpolated vector
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Lerp(const Vector<4, float>& lhs, const Vector<4, float>& rhs, const Vector<4, float>& t) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_add_ps(lhs.data, _mm_mul_ps(_mm_sub_ps(rhs.data, lhs.data), t.data));
+#else
+		result.raw[0] = lhs.raw[0] + (rhs.raw[0] - lhs.raw[0]) * t.raw[0];
+		result.raw[1] = lhs.raw[1] + (rhs.raw[1] - lhs.raw[1]) * t.raw[1];
+		result.raw[2] = lhs.raw[2] + (rhs.raw[2] - lhs.raw[2]) * t.raw[2];
+		result.raw[3] = lhs.raw[3] + (rhs.raw[3] - lhs.raw[3]) * t.raw[3];
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Lerp(const Vector<4, double>& lhs, const Vector<4, double>& rhs, const Vector<4, double>& t) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = lhs.raw[0] + (rhs.raw[0] - lhs.raw[0]) * t.raw[0];
+		result.raw[1] = lhs.raw[1] + (rhs.raw[1] - lhs.raw[1]) * t.raw[1];
+		result.raw[2] = lhs.raw[2] + (rhs.raw[2] - lhs.raw[2]) * t.raw[2];
+		result.raw[3] = lhs.raw[3] + (rhs.raw[3] - lhs.raw[3]) * t.raw[3];
+
+		return result;
+	}
+
+	/**
+	 * Component-wise floor
+	 * 
+	 * @param input vector
+	 * @return component-wise result
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Floor(const Vector<4, float>& vector) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE41_BIT)
+		result.data = _mm_round_ps(vector.data, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+#else
+		result.raw[0] = std::floor(vector.raw[0]);
+		result.raw[1] = std::floor(vector.raw[1]);
+		result.raw[2] = std::floor(vector.raw[2]);
+		result.raw[3] = std::floor(vector.raw[3]);
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Floor(const Vector<4, double>& vector) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = std::floor(vector.raw[0]);
+		result.raw[1] = std::floor(vector.raw[1]);
+		result.raw[2] = std::floor(vector.raw[2]);
+		result.raw[3] = std::floor(vector.raw[3]);
+
+		return result;
+	}
+
+	/**
+	 * Component-wise ceiling
+	 * 
+	 * @param input vector
+	 * @return component-wise result
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Ceil(const Vector<4, float>& vector) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE41_BIT)
+		result.data = _mm_round_ps(vector.data, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+#else
+		result.raw[0] = std::ceil(vector.raw[0]);
+		result.raw[1] = std::ceil(vector.raw[1]);
+		result.raw[2] = std::ceil(vector.raw[2]);
+		result.raw[3] = std::ceil(vector.raw[3]);
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Ceil(const Vector<4, double>& vector) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = std::ceil(vector.raw[0]);
+		result.raw[1] = std::ceil(vector.raw[1]);
+		result.raw[2] = std::ceil(vector.raw[2]);
+		result.raw[3] = std::ceil(vector.raw[3]);
+
+		return result;
+	}
+
+	/**
+	 * Component-wise rounding to the nearest integer, halfway cases are rounded to even
+	 * 
+	 * @param input vector
+	 * @return component-wise result
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Round(const Vector<4, float>& vector) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE41_BIT)
+		result.data = _mm_round_ps(vector.data, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+		result.raw[0] = std::nearbyint(vector.raw[0]);
+		result.raw[1] = std::nearbyint(vector.raw[1]);
+		result.raw[2] = std::nearbyint(vector.raw[2]);
+		result.raw[3] = std::nearbyint(vector.raw[3]);
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Round(const Vector<4, double>& vector) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = std::nearbyint(vector.raw[0]);
+		result.raw[1] = std::nearbyint(vector.raw[1]);
+		result.raw[2] = std::nearbyint(vector.raw[2]);
+		result.raw[3] = std::nearbyint(vector.raw[3]);
+
+		return result;
+	}
+
+	/**
+	 * Component-wise square root
+	 * 
+	 * @param input vector
+	 * @return component-wise result
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Sqrt(const Vector<4, float>& vector) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_sqrt_ps(vector.data);
+#else
+		result.raw[0] = std::sqrt(vector.raw[0]);
+		result.raw[1] = std::sqrt(vector.raw[1]);
+		result.raw[2] = std::sqrt(vector.raw[2]);
+		result.raw[3] = std::sqrt(vector.raw[3]);
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Sqrt(const Vector<4, double>& vector) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = std::sqrt(vector.raw[0]);
+		result.raw[1] = std::sqrt(vector.raw[1]);
+		result.raw[2] = std::sqrt(vector.raw[2]);
+		result.raw[3] = std::sqrt(vector.raw[3]);
+
+		return result;
+	}
+
+	/**
+	 * Component-wise reciprocal, 1 / vector
+	 * 
+	 * @param input vector
+	 * @return component-wise result
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Reciprocal(const Vector<4, float>& vector) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_div_ps(_mm_set1_ps(1.0f), vector.data);
+#else
+		result.raw[0] = 1.0f / vector.raw[0];
+		result.raw[1] = 1.0f / vector.raw[1];
+		result.raw[2] = 1.0f / vector.raw[2];
+		result.raw[3] = 1.0f / vector.raw[3];
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Reciprocal(const Vector<4, double>& vector) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = 1.0 / vector.raw[0];
+		result.raw[1] = 1.0 / vector.raw[1];
+		result.raw[2] = 1.0 / vector.raw[2];
+		result.raw[3] = 1.0 / vector.raw[3];
+
+		return result;
+	}
+
+	/**
+	 * Component-wise reciprocal square root, 1 / sqrt(vector). The float SIMD path refines the hardware estimate
+	 * with one Newton-Raphson step (about 22 correct bits) instead of dividing. Zero gives infinity and infinity
+	 * gives zero on every tier
+	 * 
+	 * @param input vector
+	 * @return component-wise result
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Rsqrt(const Vector<4, float>& vector) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = Implementation::ReciprocalSqrt(vector.data);
+#else
+		result.raw[0] = 1.0f / std::sqrt(vector.raw[0]);
+		result.raw[1] = 1.0f / std::sqrt(vector.raw[1]);
+		result.raw[2] = 1.0f / std::sqrt(vector.raw[2]);
+		result.raw[3] = 1.0f / std::sqrt(vector.raw[3]);
+#endif
 		return result;
 	}
-}
\ No newline at end of file
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Rsqrt(const Vector<4, double>& vector) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = 1.0 / std::sqrt(vector.raw[0]);
+		result.raw[1] = 1.0 / std::sqrt(vector.raw[1]);
+		result.raw[2] = 1.0 / std::sqrt(vector.raw[2]);
+		result.raw[3] = 1.0 / std::sqrt(vector.raw[3]);
+
+		return result;
+	}
+
+	/**
+	 * Component-wise lhs < rhs
+	 * 
+	 * @param input lhs vector
+	 * @param input rhs vector
+	 * @return mask, all bits of a component are set where the comparison holds
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL LessThan(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_cmplt_ps(lhs.data, rhs.data);
+#else
+		constexpr float set{ std::bit_cast<float>(0xFFFF'FFFFU) };
+		result.raw[0] = lhs.raw[0] < rhs.raw[0] ? set : 0.0f;
+		result.raw[1] = lhs.raw[1] < rhs.raw[1] ? set : 0.0f;
+		result.raw[2] = lhs.raw[2] < rhs.raw[2] ? set : 0.0f;
+		result.raw[3] = lhs.raw[3] < rhs.raw[3] ? set : 0.0f;
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL LessThan(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+	{
+		constexpr double set{ std::bit_cast<double>(0xFFFF'FFFF'FFFF'FFFFULL) };
+		Vector<4, double> result;
+
+		result.raw[0] = lhs.raw[0] < rhs.raw[0] ? set : 0.0;
+		result.raw[1] = lhs.raw[1] < rhs.raw[1] ? set : 0.0;
+		result.raw[2] = lhs.raw[2] < rhs.raw[2] ? set : 0.0;
+		result.raw[3] = lhs.raw[3] < rhs.raw[3] ? set : 0.0;
+
+		return result;
+	}
+
+	/**
+	 * Component-wise lhs <= rhs
+	 * 
+	 * @param input lhs vector
+	 * @param input rhs vector
+	 * @return mask, all bits of a component are set where the comparison holds
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL LessEqual(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_cmple_ps(lhs.data, rhs.data);
+#else
+		constexpr float set{ std::bit_cast<float>(0xFFFF'FFFFU) };
+		result.raw[0] = lhs.raw[0] <= rhs.raw[0] ? set : 0.0f;
+		result.raw[1] = lhs.raw[1] <= rhs.raw[1] ? set : 0.0f;
+		result.raw[2] = lhs.raw[2] <= rhs.raw[2] ? set : 0.0f;
+		result.raw[3] = lhs.raw[3] <= rhs.raw[3] ? set : 0.0f;
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL LessEqual(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+	{
+		constexpr double set{ std::bit_cast<double>(0xFFFF'FFFF'FFFF'FFFFULL) };
+		Vector<4, double> result;
+
+		result.raw[0] = lhs.raw[0] <= rhs.raw[0] ? set : 0.0;
+		result.raw[1] = lhs.raw[1] <= rhs.raw[1] ? set : 0.0;
+		result.raw[2] = lhs.raw[2] <= rhs.raw[2] ? set : 0.0;
+		result.raw[3] = lhs.raw[3] <= rhs.raw[3] ? set : 0.0;
+
+		return result;
+	}
+
+	/**
+	 * Component-wise lhs > rhs
+	 * 
+	 * @param input lhs vector
+	 * @param input rhs vector
+	 * @return mask, all bits of a component are set where the comparison holds
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL GreaterThan(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_cmpgt_ps(lhs.data, rhs.data);
+#else
+		constexpr float set{ std::bit_cast<float>(0xFFFF'FFFFU) };
+		result.raw[0] = lhs.raw[0] > rhs.raw[0] ? set : 0.0f;
+		result.raw[1] = lhs.raw[1] > rhs.raw[1] ? set : 0.0f;
+		result.raw[2] = lhs.raw[2] > rhs.raw[2] ? set : 0.0f;
+		result.raw[3] = lhs.raw[3] > rhs.raw[3] ? set : 0.0f;
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL GreaterThan(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+	{
+		constexpr double set{ std::bit_cast<double>(0xFFFF'FFFF'FFFF'FFFFULL) };
+		Vector<4, double> result;
+
+		result.raw[0] = lhs.raw[0] > rhs.raw[0] ? set : 0.0;
+		result.raw[1] = lhs.raw[1] > rhs.raw[1] ? set : 0.0;
+		result.raw[2] = lhs.raw[2] > rhs.raw[2] ? set : 0.0;
+		result.raw[3] = lhs.raw[3] > rhs.raw[3] ? set : 0.0;
+
+		return result;
+	}
+
+	/**
+	 * Component-wise lhs >= rhs
+	 * 
+	 * @param input lhs vector
+	 * @param input rhs vector
+	 * @return mask, all bits of a component are set where the comparison holds
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL GreaterEqual(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_cmpge_ps(lhs.data, rhs.data);
+#else
+		constexpr float set{ std::bit_cast<float>(0xFFFF'FFFFU) };
+		result.raw[0] = lhs.raw[0] >= rhs.raw[0] ? set : 0.0f;
+		result.raw[1] = lhs.raw[1] >= rhs.raw[1] ? set : 0.0f;
+		result.raw[2] = lhs.raw[2] >= rhs.raw[2] ? set : 0.0f;
+		result.raw[3] = lhs.raw[3] >= rhs.raw[3] ? set : 0.0f;
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL GreaterEqual(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+	{
+		constexpr double set{ std::bit_cast<double>(0xFFFF'FFFF'FFFF'FFFFULL) };
+		Vector<4, double> result;
+
+		result.raw[0] = lhs.raw[0] >= rhs.raw[0] ? set : 0.0;
+		result.raw[1] = lhs.raw[1] >= rhs.raw[1] ? set : 0.0;
+		result.raw[2] = lhs.raw[2] >= rhs.raw[2] ? set : 0.0;
+		result.raw[3] = lhs.raw[3] >= rhs.raw[3] ? set : 0.0;
+
+		return result;
+	}
+
+	/**
+	 * Component-wise lhs == rhs
+	 * 
+	 * @param input lhs vector
+	 * @param input rhs vector
+	 * @return mask, all bits of a component are set where the comparison holds
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Equal(const Vector<4, float>& lhs, const Vector<4, float>& rhs) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_cmpeq_ps(lhs.data, rhs.data);
+#else
+		constexpr float set{ std::bit_cast<float>(0xFFFF'FFFFU) };
+		result.raw[0] = lhs.raw[0] == rhs.raw[0] ? set : 0.0f;
+		result.raw[1] = lhs.raw[1] == rhs.raw[1] ? set : 0.0f;
+		result.raw[2] = lhs.raw[2] == rhs.raw[2] ? set : 0.0f;
+		result.raw[3] = lhs.raw[3] == rhs.raw[3] ? set : 0.0f;
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Equal(const Vector<4, double>& lhs, const Vector<4, double>& rhs) noexcept
+	{
+		constexpr double set{ std::bit_cast<double>(0xFFFF'FFFF'FFFF'FFFFULL) };
+		Vector<4, double> result;
+
+		result.raw[0] = lhs.raw[0] == rhs.raw[0] ? set : 0.0;
+		result.raw[1] = lhs.raw[1] == rhs.raw[1] ? set : 0.0;
+		result.raw[2] = lhs.raw[2] == rhs.raw[2] ? set : 0.0;
+		result.raw[3] = lhs.raw[3] == rhs.raw[3] ? set : 0.0;
+
+		return result;
+	}
+
+	/**
+	 * Selects components by a mask (see LessThan, GreaterThan, ...), onTrue where the mask is set, onFalse elsewhere
+	 * 
+	 * @param input mask, every component either all bits set or all bits clear
+	 * @param input components picked where the mask is clear
+	 * @param input components picked where the mask is set
+	 * @return selected vector
+	 */
+	CIN_MATH_INLINE Vector<4, float> CIN_MATH_CALL Select(const Vector<4, float>& mask, const Vector<4, float>& onFalse, const Vector<4, float>& onTrue) noexcept
+	{
+		Vector<4, float> result;
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE41_BIT)
+		result.data = _mm_blendv_ps(onFalse.data, onTrue.data, mask.data);
+#elif (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		result.data = _mm_or_ps(_mm_and_ps(mask.data, onTrue.data), _mm_andnot_ps(mask.data, onFalse.data));
+#else
+		result.raw[0] = std::bit_cast<std::uint32_t>(mask.raw[0]) ? onTrue.raw[0] : onFalse.raw[0];
+		result.raw[1] = std::bit_cast<std::uint32_t>(mask.raw[1]) ? onTrue.raw[1] : onFalse.raw[1];
+		result.raw[2] = std::bit_cast<std::uint32_t>(mask.raw[2]) ? onTrue.raw[2] : onFalse.raw[2];
+		result.raw[3] = std::bit_cast<std::uint32_t>(mask.raw[3]) ? onTrue.raw[3] : onFalse.raw[3];
+#endif
+		return result;
+	}
+
+	CIN_MATH_INLINE Vector<4, double> CIN_MATH_CALL Select(const Vector<4, double>& mask, const Vector<4, double>& onFalse, const Vector<4, double>& onTrue) noexcept
+	{
+		Vector<4, double> result;
+
+		result.raw[0] = std::bit_cast<std::uint64_t>(mask.raw[0]) ? onTrue.raw[0] : onFalse.raw[0];
+		result.raw[1] = std::bit_cast<std::uint64_t>(mask.raw[1]) ? onTrue.raw[1] : onFalse.raw[1];
+		result.raw[2] = std::bit_cast<std::uint64_t>(mask.raw[2]) ? onTrue.raw[2] : onFalse.raw[2];
+		result.raw[3] = std::bit_cast<std::uint64_t>(mask.raw[3]) ? onTrue.raw[3] : onFalse.raw[3];
+
+		return result;
+	}
+
+	/**
+	 * Sum of the components, computed as (x + y) + (z + w)
+	 * 
+	 * @param input vector
+	 * @return reduced scalar
+	 */
+	CIN_MATH_INLINE float CIN_MATH_CALL HorizontalAdd(const Vector<4, float>& vector) noexcept
+	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		return _mm_cvtss_f32(Implementation::SumBroadcast(vector.data));
+#else
+		return (vector.raw[0] + vector.raw[1]) + (vector.raw[2] + vector.raw[3]);
+#endif
+	}
+
+	CIN_MATH_INLINE double CIN_MATH_CALL HorizontalAdd(const Vector<4, double>& vector) noexcept
+	{
+		return (vector.raw[0] + vector.raw[1]) + (vector.raw[2] + vector.raw[3]);
+	}
+
+	/**
+	 * Smallest component
+	 * 
+	 * @param input vector
+	 * @return reduced scalar
+	 */
+	CIN_MATH_INLINE float CIN_MATH_CALL HorizontalMin(const Vector<4, float>& vector) noexcept
+	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		/* (x, y, z, w) op (y, x, w, z), then op with the other half */
+		const __m128 pairs{ _mm_min_ps(vector.data, _mm_shuffle_ps(vector.data, vector.data, 0b10'11'00'01)) };
+		return _mm_cvtss_f32(_mm_min_ps(pairs, _mm_shuffle_ps(pairs, pairs, 0b01'00'11'10)));
+#else
+		return std::min(std::min(vector.raw[0], vector.raw[1]), std::min(vector.raw[2], vector.raw[3]));
+#endif
+	}
+
+	CIN_MATH_INLINE double CIN_MATH_CALL HorizontalMin(const Vector<4, double>& vector) noexcept
+	{
+		return std::min(std::min(vector.raw[0], vector.raw[1]), std::min(vector.raw[2], vector.raw[3]));
+	}
+
+	/**
+	 * Largest component
+	 * 
+	 * @param input vector
+	 * @return reduced scalar
+	 */
+	CIN_MATH_INLINE float CIN_MATH_CALL HorizontalMax(const Vector<4, float>& vector) noexcept
+	{
+#if (CIN_INSTRUCTION_SET) & (CIN_INSTRUCTION_SET_SSE_BIT)
+		/* (x, y, z, w) op (y, x, w, z), then op with the other half */
+		const __m128 pairs{ _mm_max_ps(vector.data, _mm_shuffle_ps(vector.data, vector.data, 0b10'11'00'01)) };
+		return _mm_cvtss_f32(_mm_max_ps(pairs, _mm_shuffle_ps(pairs, pairs, 0b01'00'11'10)));
+#else
+		return std::max(std::max(vector.raw[0], vector.raw[1]), std::max(vector.raw[2], vector.raw[3]));
+#endif
+	}
+
+	CIN_MATH_INLINE double CIN_MATH_CALL HorizontalMax(const Vector<4, double>& vector) noexcept
+	{
+		return std::max(std::max(vector.raw[0], vector.raw[1]), std::max(vector.raw[2], vector.raw[3]));
+	}
+}
@@ -1,8 +1,21 @@
+/* The per instruction set targets (TestSuite_<isa>) select the tier on the command line */
+#ifndef CIN_MATH_INSTRUCTION_SET_FROM_BUILD
 #define CIN_USE_DEFAULT_INSTRUCTION_SET
 //#define CIN_USE_SSE
 //#define CIN_USE_AVX
+#endif
+#define CIN_MATH_PROFILE
 #include "CinMath/CinMath.h"
 
+#include "CinMath/Parallel.h"
+#include "CinMath/Execution.h"
+#include "CinMath/Archive.h"
+#include "CinMath/Pipeline.h"
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
 #define TEST_PRINTING 0
 
 constinit static size_t s_PassedTests{ 0U };
@@ -25,6 +38,9 @@ static void TestVector3() noexcept;
 template<typename ValueType>
 static void TestVector4() noexcept;
 
+template<typename ValueType>
+static void TestVector4Functions() noexcept;
+
 template<typename ValueType>
 static void TestSwizzling() noexcept;
 
@@ -62,6 +78,42 @@ static void TestOther() noexcept;
 template<typename ValueType>
 static void TestProjection() noexcept;
 
+template<typename ValueType>
+static void TestConstantEvaluation() noexcept;
+
+template<typename ValueType>
+static void TestMemory() noexcept;
+
+template<typename ValueType>
+static void TestBatch() noexcept;
+
+template<typename ValueType>
+static void TestMatrix4SoA() noexcept;
+
+template<typename ValueType>
+static void TestHalf() noexcept;
+
+template<typename ValueType>
+static void TestQuantization() noexcept;
+
+template<typename ValueType>
+static void TestArchive() noexcept;
+
+template<typename ValueType>
+static void TestFormat() noexcept;
+
+template<typename ValueType>
+static void TestMatrixPrinting() noexcept;
+
+template<typename ValueType>
+static void TestPipeline() noexcept;
+
+template<typename ValueType>
+static void TestProfile() noexcept;
+
+static int WriteEquivalence(const char* path) noexcept;
+static int CheckEquivalence(const char* path) noexcept;
+
 #define TEST(TestName) Test##TestName<float>(); Test##TestName<double>()
 
 template<typename ValueType>
@@ -85,13 +137,32 @@ bool ApproximateMatrix(const CinMath::Matrix<rows, columns, ValueType>& lhs, con
 
 int main([[maybe_unused]] const int argc, [[maybe_unused]] const char** argv) noexcept
 {
+	/* Cross tier equivalence, see WriteEquivalence */
+	if (argc == 3 && std::string_view{ argv[1] } == "--equivalence-write")
+		return WriteEquivalence(argv[2]);
+
+	if (argc == 3 && std::string_view{ argv[1] } == "--equivalence-check")
+		return CheckEquivalence(argv[2]);
+
 	std::cout << "Tested instruction set:\n";
 #if defined CIN_USE_DEFAULT_INSTRUCTION_SET
 	std::cout << "Default";
-#elif defined CIN_USE_SSE
-	std::cout << "SSE";
+#elif defined CIN_USE_AVX2
+	std::cout << "AVX2";
 #elif defined CIN_USE_AVX
 	std::cout << "AVX";
+#elif defined CIN_USE_SSE42
+	std::cout << "SSE42";
+#elif defined CIN_USE_SSE41
+	std::cout << "SSE41";
+#elif defined CIN_USE_SSSE3
+	std::cout << "SSSE3";
+#elif defined CIN_USE_SSE3
+	std::cout << "SSE3";
+#elif defined CIN_USE_SSE2
+	std::cout << "SSE2";
+#elif defined CIN_USE_SSE
+	std::cout << "SSE";
 #else
 	std::cout << "UNKNOWN\n";
 #endif
@@ -99,6 +170,7 @@ int main([[maybe_unused]] const int argc, [[maybe_unused]] const char** argv) no
 	TEST(Vector2);
 	TEST(Vector3);
 	TEST(Vector4);
+	TEST(Vector4Functions);
 
 	/* Matrices */
 	TEST(Matrix2x2);
@@ -120,6 +192,19 @@ int main([[maybe_unused]] const int argc, [[maybe_unused]] const char** argv) no
 	/* Other */
 	TEST(Other);
 	TEST(Projection);
+	TEST(ConstantEvaluation);
+	TEST(Memory);
+	TEST(Batch);
+	/* The lane containers are float only */
+	TestMatrix4SoA<float>();
+	TEST(Half);
+	/* Packed encodings decode to float only */
+	TestQuantization<float>();
+	TEST(Archive);
+	TEST(Format);
+	TEST(MatrixPrinting);
+	TEST(Pipeline);
+	TEST(Profile);
 #if TEST_PRINTING
 	TEST(Printing);
 #endif
@@ -351,6 +436,29 @@ static void TestVector2() noexcept
 		const bool result{ casted == lhs };
 		TEST_ASSERT(result);
 	}
+	/* Register arithmetic against the scalar formulas, the operands are exact in binary so every tier must agree bit for bit */
+	{
+		constexpr VectorType lhs{ static_cast<ValueType>(1.25), static_cast<ValueType>(-2.5) };
+		constexpr VectorType rhs{ static_cast<ValueType>(0.5), static_cast<ValueType>(4.0) };
+		constexpr ValueType scalar{ static_cast<ValueType>(-0.75) };
+
+		TEST_ASSERT((lhs + rhs) == VectorType(lhs.x + rhs.x, lhs.y + rhs.y))
+		TEST_ASSERT((lhs - rhs) == VectorType(lhs.x - rhs.x, lhs.y - rhs.y))
+		TEST_ASSERT((lhs * rhs) == VectorType(lhs.x * rhs.x, lhs.y * rhs.y))
+		TEST_ASSERT((lhs / rhs) == VectorType(lhs.x / rhs.x, lhs.y / rhs.y))
+		TEST_ASSERT((lhs * scalar) == VectorType(lhs.x * scalar, lhs.y * scalar))
+		TEST_ASSERT((lhs / scalar) == VectorType(lhs.x / scalar, lhs.y / scalar))
+		TEST_ASSERT((-lhs) == VectorType(-lhs.x, -lhs.y))
+
+		const ValueType dot{ lhs.x * rhs.x + lhs.y * rhs.y };
+		TEST_ASSERT(Dot(lhs, rhs) == dot)
+		TEST_ASSERT(Length(lhs) == std::sqrt(lhs.x * lhs.x + lhs.y * lhs.y))
+
+		const VectorType normalized{ Normalize(lhs) };
+		const ValueType length{ std::sqrt(lhs.x * lhs.x + lhs.y * lhs.y) };
+		const ValueType tolerance{ 4 * std::numeric_limits<ValueType>::epsilon() };
+		TEST_ASSERT(std::abs(normalized.x - lhs.x / length) <= tolerance && std::abs(normalized.y - lhs.y / length) <= tolerance)
+	}
 }
 
 template<typename ValueType>
@@ -811,6 +919,139 @@ static void TestVector4() noexcept
 		const bool result{ casted == lhs };
 		TEST_ASSERT(result);
 	}
+	/* Register arithmetic against the scalar formulas, the operands are exact in binary so every tier must agree bit for bit */
+	{
+		constexpr VectorType lhs{ static_cast<ValueType>(1.25), static_cast<ValueType>(-2.5), static_cast<ValueType>(3.75), static_cast<ValueType>(-0.5) };
+		constexpr VectorType rhs{ static_cast<ValueType>(0.5), static_cast<ValueType>(4.0), static_cast<ValueType>(-1.25), static_cast<ValueType>(2.0) };
+		constexpr ValueType scalar{ static_cast<ValueType>(-0.75) };
+
+		TEST_ASSERT((lhs + rhs) == VectorType(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w))
+		TEST_ASSERT((lhs - rhs) == VectorType(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w))
+		TEST_ASSERT((lhs * rhs) == VectorType(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w))
+		TEST_ASSERT((lhs / rhs) == VectorType(lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w))
+		TEST_ASSERT((lhs * scalar) == VectorType(lhs.x * scalar, lhs.y * scalar, lhs.z * scalar, lhs.w * scalar))
+		TEST_ASSERT((lhs / scalar) == VectorType(lhs.x / scalar, lhs.y / scalar, lhs.z / scalar, lhs.w / scalar))
+		TEST_ASSERT((-lhs) == VectorType(-lhs.x, -lhs.y, -lhs.z, -lhs.w))
+
+		const ValueType dot{ lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w };
+		const ValueType squaredLength{ lhs.x * lhs.x + lhs.y * lhs.y + lhs.z * lhs.z + lhs.w * lhs.w };
+		TEST_ASSERT(Dot(lhs, rhs) == dot)
+		TEST_ASSERT(Length(lhs) == std::sqrt(squaredLength))
+
+		const VectorType normalized{ Normalize(lhs) };
+		const ValueType length{ std::sqrt(squaredLength) };
+		const ValueType tolerance{ 4 * std::numeric_limits<ValueType>::epsilon() };
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < 4U; ++i)
+			success &= std::abs(normalized[i] - lhs[i] / length) <= tolerance;
+		TEST_ASSERT(success)
+
+		/* Matrix times column vector and row vector times matrix, the storage is column major */
+		std::array<ValueType, 16> elements{};
+		for (std::size_t i{ 0U }; i < 16U; ++i)
+			elements[i] = static_cast<ValueType>(static_cast<double>(i) * 0.25 - 2.0);
+
+		const Matrix<4, 4, ValueType> matrix{ std::move(elements) };
+		const VectorType column{ matrix * lhs };
+		const VectorType row{ lhs * matrix };
+		for (std::size_t i{ 0U }; i < 4U; ++i)
+		{
+			success &= column[i] == lhs.x * matrix[i] + lhs.y * matrix[4U + i] + lhs.z * matrix[8U + i] + lhs.w * matrix[12U + i];
+			success &= row[i] == lhs.x * matrix[4U * i] + lhs.y * matrix[4U * i + 1U] + lhs.z * matrix[4U * i + 2U] + lhs.w * matrix[4U * i + 3U];
+		}
+		TEST_ASSERT(success)
+	}
+}
+
+template<typename ValueType>
+static void TestVector4Functions() noexcept
+{
+	using namespace CinMath;
+	using Vector4Type = Vector<4, ValueType>;
+	const auto value = [](const double value) noexcept { return static_cast<ValueType>(value); };
+
+	const Vector4Type lhs{ value(-1.5), value(2.5), value(3.0), value(-4.25) };
+	const Vector4Type rhs{ value(1.0), value(-2.0), value(3.0), value(4.0) };
+
+	/* Min, max, abs, clamp */
+	{
+		TEST_ASSERT(Min(lhs, rhs) == Vector4Type(value(-1.5), value(-2.0), value(3.0), value(-4.25)))
+		TEST_ASSERT(Max(lhs, rhs) == Vector4Type(value(1.0), value(2.5), value(3.0), value(4.0)))
+		TEST_ASSERT(Abs(lhs) == Vector4Type(value(1.5), value(2.5), value(3.0), value(4.25)))
+		TEST_ASSERT(Abs(Vector4Type(value(-0.0))) == Vector4Type(value(0.0)))
+		TEST_ASSERT(Clamp(lhs, Vector4Type(value(-1.0)), Vector4Type(value(2.0))) == Vector4Type(value(-1.0), value(2.0), value(2.0), value(-1.0)))
+	}
+
+	/* Lerp */
+	{
+		TEST_ASSERT(Lerp(lhs, rhs, value(0.0)) == lhs)
+		TEST_ASSERT(Lerp(lhs, rhs, value(1.0)) == rhs)
+		TEST_ASSERT(Lerp(lhs, rhs, value(0.5)) == Vector4Type(value(-0.25), value(0.25), value(3.0), value(-0.125)))
+		TEST_ASSERT(Lerp(lhs, rhs, Vector4Type(value(0.0), value(1.0), value(0.5), value(0.0))) == Vector4Type(value(-1.5), value(-2.0), value(3.0), value(-4.25)))
+	}
+
+	/* Rounding */
+	{
+		const Vector4Type vector{ value(-1.5), value(2.5), value(0.25), value(-0.75) };
+		TEST_ASSERT(Floor(vector) == Vector4Type(value(-2.0), value(2.0), value(0.0), value(-1.0)))
+		TEST_ASSERT(Ceil(vector) == Vector4Type(value(-1.0), value(3.0), value(1.0), value(-0.0)))
+		/* Halfway cases go to even */
+		TEST_ASSERT(Round(vector) == Vector4Type(value(-2.0), value(2.0), value(0.0), value(-1.0)))
+	}
+
+	/* Square roots and reciprocals */
+	{
+		const Vector4Type vector{ value(1.0), value(4.0), value(16.0), value(0.25) };
+		TEST_ASSERT(Sqrt(vector) == Vector4Type(value(1.0), value(2.0), value(4.0), value(0.5)))
+		TEST_ASSERT(Reciprocal(vector) == Vector4Type(value(1.0), value(0.25), value(0.0625), value(4.0)))
+
+		/* The float SIMD path is an estimate refined once, good to about 1e-6 relative */
+		const Vector4Type rsqrt{ Rsqrt(vector) };
+		TEST_ASSERT(Approximate<ValueType>(rsqrt.x, value(1.0)))
+		TEST_ASSERT(Approximate<ValueType>(rsqrt.y, value(0.5)))
+		TEST_ASSERT(Approximate<ValueType>(rsqrt.z, value(0.25)))
+		TEST_ASSERT(Approximate<ValueType>(rsqrt.w, value(2.0)))
+
+		/* Zero and infinity, like 1 / std::sqrt */
+		const Vector4Type limits{ Rsqrt(Vector4Type(value(0.0), value(-0.0), std::numeric_limits<ValueType>::infinity(), value(4.0))) };
+		TEST_ASSERT(std::isinf(limits.x) && limits.x > value(0.0))
+		TEST_ASSERT(std::isinf(limits.y) && limits.y < value(0.0))
+		TEST_ASSERT(limits.z == value(0.0))
+		TEST_ASSERT(Approximate<ValueType>(limits.w, value(0.5)))
+	}
+
+	/* Comparison masks and select */
+	{
+		const Vector4Type onFalse{ value(0.0) };
+		const Vector4Type onTrue{ value(1.0) };
+		TEST_ASSERT(Select(LessThan(lhs, rhs), onFalse, onTrue) == Vector4Type(value(1.0), value(0.0), value(0.0), value(1.0)))
+		TEST_ASSERT(Select(LessEqual(lhs, rhs), onFalse, onTrue) == Vector4Type(value(1.0), value(0.0), value(1.0), value(1.0)))
+		TEST_ASSERT(Select(GreaterThan(lhs, rhs), onFalse, onTrue) == Vector4Type(value(0.0), value(1.0), value(0.0), value(0.0)))
+		TEST_ASSERT(Select(GreaterEqual(lhs, rhs), onFalse, onTrue) == Vector4Type(value(0.0), value(1.0), value(1.0), value(0.0)))
+		TEST_ASSERT(Select(Equal(lhs, rhs), onFalse, onTrue) == Vector4Type(value(0.0), value(0.0), value(1.0), value(0.0)))
+		TEST_ASSERT(Select(LessThan(lhs, rhs), lhs, rhs) == Max(lhs, rhs))
+	}
+
+	/* Row vector times matrix, result[i] = dot(vector, matrix[4i .. 4i + 3]) */
+	{
+		std::array<ValueType, 16> elements{};
+		for (std::size_t i{ 0U }; i < 16U; ++i)
+			elements[i] = value(static_cast<double>(i) - 7.5);
+
+		const Matrix<4, 4, ValueType> matrix{ std::move(elements) };
+		const Vector4Type product{ lhs * matrix };
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < 4U; ++i)
+			success &= product[i] == lhs.x * matrix[4U * i] + lhs.y * matrix[4U * i + 1U] + lhs.z * matrix[4U * i + 2U] + lhs.w * matrix[4U * i + 3U];
+		TEST_ASSERT(success)
+	}
+
+	/* Horizontal reductions */
+	{
+		TEST_ASSERT(HorizontalAdd(lhs) == value(-0.25))
+		TEST_ASSERT(HorizontalMin(lhs) == value(-4.25))
+		TEST_ASSERT(HorizontalMax(lhs) == value(3.0))
+	}
 }
 
 template<typename ValueType>
@@ -852,6 +1093,44 @@ static void TestSwizzling() noexcept
 		TEST_ASSERT(vector.yzw == Vector3Type(vector.y, vector.z, vector.w))
 
 		TEST_ASSERT(vector.xyzw == Vector4Type(vector.x, vector.y, vector.z, vector.w))
+
+		TEST_ASSERT(vector.wwww == Vector4Type(vector.w))
+		TEST_ASSERT(vector.wzyx == Vector4Type(vector.w, vector.z, vector.y, vector.x))
+		TEST_ASSERT(vector.zxyw == Vector4Type(vector.z, vector.x, vector.y, vector.w))
+		TEST_ASSERT(vector.xxyy == Vector4Type(vector.x, vector.x, vector.y, vector.y))
+	}
+
+	/* Vector4 swizzle writes */
+	{
+		const Vector4Type source{ static_cast<ValueType>(1.0), static_cast<ValueType>(2.0), static_cast<ValueType>(3.0), static_cast<ValueType>(4.0) };
+
+		Vector4Type vector{};
+		vector.wzyx = source;
+		TEST_ASSERT(vector == Vector4Type(source.w, source.z, source.y, source.x))
+
+		vector.yzxw = source;
+		TEST_ASSERT(vector.yzxw == source)
+		TEST_ASSERT(vector == Vector4Type(source.z, source.x, source.y, source.w))
+
+		/* Partial writes leave the other components alone */
+		vector = source;
+		vector.xy = Vector2Type(static_cast<ValueType>(5.0), static_cast<ValueType>(6.0));
+		TEST_ASSERT(vector == Vector4Type(static_cast<ValueType>(5.0), static_cast<ValueType>(6.0), source.z, source.w))
+
+		vector = source;
+		vector.yzw = Vector3Type(static_cast<ValueType>(5.0), static_cast<ValueType>(6.0), static_cast<ValueType>(7.0));
+		TEST_ASSERT(vector == Vector4Type(source.x, static_cast<ValueType>(5.0), static_cast<ValueType>(6.0), static_cast<ValueType>(7.0)))
+	}
+
+	/* Swizzle, shuffle and blend */
+	{
+		const Vector4Type lhs{ static_cast<ValueType>(1.0), static_cast<ValueType>(2.0), static_cast<ValueType>(3.0), static_cast<ValueType>(4.0) };
+		const Vector4Type rhs{ static_cast<ValueType>(5.0), static_cast<ValueType>(6.0), static_cast<ValueType>(7.0), static_cast<ValueType>(8.0) };
+
+		TEST_ASSERT((CinMath::Swizzle<3, 0, 0, 2>(lhs) == Vector4Type(lhs.w, lhs.x, lhs.x, lhs.z)))
+		TEST_ASSERT((CinMath::Shuffle<1, 0, 3, 2>(lhs, rhs) == Vector4Type(lhs.y, lhs.x, rhs.w, rhs.z)))
+		TEST_ASSERT((CinMath::Blend<false, true, false, true>(lhs, rhs) == Vector4Type(lhs.x, rhs.y, lhs.z, rhs.w)))
+		TEST_ASSERT((CinMath::Blend<true, true, true, true>(lhs, rhs) == rhs))
 	}
 }
 
@@ -3177,121 +3456,1762 @@ static void TestProjection() noexcept
 	}
 }
 
-#if TEST_PRINTING
 template<typename ValueType>
-void TestPrinting() noexcept
+static void TestConstantEvaluation() noexcept
 {
-	using namespace CinMath::Printing;
+	using MatrixType = CinMath::Matrix<4, 4, ValueType>;
+	using Vector3Type = CinMath::Vector<3, ValueType>;
+	using AngleType = CinMath::TAngle<ValueType>;
+	using RadiansType = CinMath::TRadians<ValueType>;
 
-	const auto randomfloat
-	{
-		[]() -> float
-		{
-			return static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
-		}
-	};
-	/* Vectors */
-	std::cout << "\n--VECTOR PRINT--\n";
+	/* Transforms baked at compile time must match the ones computed at runtime */
 	{
-		using Vector4Type = CinMath::Vector<4, ValueType>;
-		constexpr Vector4Type toPrint{ 1, 2, 3, 4 };
+		constexpr AngleType angle{ RadiansType{ static_cast<ValueType>(0.7) } };
+		constexpr Vector3Type translation{ static_cast<ValueType>(1), static_cast<ValueType>(-2), static_cast<ValueType>(3) };
 
-		std::cout << "std-out\n";
-		std::cout << toPrint;
-		std::cout << "std-out-default\n";
-		std::cout << VectorPrinter(toPrint, DefaultVectorPrintSpecificer());
-		std::cout << "std-out-round\n";
-		std::cout << VectorPrinter(toPrint, RoundVectorPrintSpecificer());
-		std::cout << "std-out-curly\n";
-		std::cout << VectorPrinter(toPrint, CurlyVectorPrintSpecificer());
+		constexpr MatrixType rotationX{ CinMath::RotateXIdentity<4, 4, ValueType>(angle) };
+		constexpr MatrixType rotationXY{ CinMath::RotateY<4, 4, ValueType>(rotationX, angle) };
+		constexpr MatrixType rotationXYZ{ CinMath::RotateZ<4, 4, ValueType>(rotationXY, angle) };
+		constexpr MatrixType model{ CinMath::Translate<4, 4, ValueType>(rotationXYZ, translation) };
+		constexpr MatrixType inverseModel{ CinMath::Inverse(model) };
+		constexpr ValueType determinant{ CinMath::Determinant(model) };
+
+		const AngleType runtimeAngle{ RadiansType{ static_cast<ValueType>(0.7) } };
+		const MatrixType runtimeRotationX{ CinMath::RotateXIdentity<4, 4, ValueType>(runtimeAngle) };
+		const MatrixType runtimeRotationXY{ CinMath::RotateY<4, 4, ValueType>(runtimeRotationX, runtimeAngle) };
+		const MatrixType runtimeRotationXYZ{ CinMath::RotateZ<4, 4, ValueType>(runtimeRotationXY, runtimeAngle) };
+		const MatrixType runtimeModel{ CinMath::Translate<4, 4, ValueType>(runtimeRotationXYZ, translation) };
+
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(rotationX, runtimeRotationX)));
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(rotationXYZ, runtimeRotationXYZ)));
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(model, runtimeModel)));
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(inverseModel, CinMath::Inverse(runtimeModel))));
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(model * inverseModel, MatrixType::Identity())));
+		TEST_ASSERT(Approximate(determinant, CinMath::Determinant(runtimeModel)));
 	}
+
 	{
-		using Vector4Type = CinMath::Vector<3, ValueType>;
-		constexpr Vector4Type toPrint{ 1, 2, 3 };
+		constexpr MatrixType translation{ CinMath::TranslateIdentity<4, 4, ValueType>(Vector3Type{ static_cast<ValueType>(4), static_cast<ValueType>(5), static_cast<ValueType>(6) }) };
+		static_assert(translation.m41 == static_cast<ValueType>(4) && translation.m42 == static_cast<ValueType>(5) && translation.m43 == static_cast<ValueType>(6));
 
-		std::cout << "std-out\n";
-		std::cout << toPrint;
-		std::cout << "std-out-default\n";
-		std::cout << VectorPrinter(toPrint, DefaultVectorPrintSpecificer());
-		std::cout << "std-out-round\n";
-		std::cout << VectorPrinter(toPrint, RoundVectorPrintSpecificer());
-		std::cout << "std-out-curly\n";
-		std::cout << VectorPrinter(toPrint, CurlyVectorPrintSpecificer());
+		constexpr MatrixType orthographic{ CinMath::OrthographicProjection(static_cast<ValueType>(-2), static_cast<ValueType>(2), static_cast<ValueType>(-1), static_cast<ValueType>(1)) };
+		static_assert(orthographic.m11 == static_cast<ValueType>(0.5) && orthographic.m22 == static_cast<ValueType>(1));
+
+		constexpr ValueType FOV{ static_cast<ValueType>(1.2) };
+		constexpr ValueType aspectRatio{ static_cast<ValueType>(16.0 / 9.0) };
+		constexpr ValueType nearClip{ static_cast<ValueType>(0.1) };
+		constexpr ValueType farClip{ static_cast<ValueType>(100) };
+
+		constexpr MatrixType perspective{ CinMath::PerspectiveProjection(FOV, aspectRatio, nearClip, farClip) };
+		const MatrixType runtimePerspective{ CinMath::PerspectiveProjection(FOV, aspectRatio, nearClip, farClip) };
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(perspective, runtimePerspective)));
 	}
+
+	/* Angles beyond the range of long long reduce without overflow, infinity gives NaN like std::sin */
 	{
-		using Vector4Type = CinMath::Vector<2, ValueType>;
-		constexpr Vector4Type toPrint{ 1, 2 };
+		constexpr MatrixType huge{ CinMath::RotateXIdentity<4, 4, ValueType>(AngleType{ RadiansType{ static_cast<ValueType>(1e30) } }) };
+		static_assert(huge.m22 >= static_cast<ValueType>(-1) && huge.m22 <= static_cast<ValueType>(1) && huge.m23 >= static_cast<ValueType>(-1) && huge.m23 <= static_cast<ValueType>(1));
 
-		std::cout << "std-out\n";
-		std::cout << toPrint;
-		std::cout << "std-out-default\n";
-		std::cout << VectorPrinter(toPrint, DefaultVectorPrintSpecificer());
-		std::cout << "std-out-round\n";
-		std::cout << VectorPrinter(toPrint, RoundVectorPrintSpecificer());
-		std::cout << "std-out-curly\n";
-		std::cout << VectorPrinter(toPrint, CurlyVectorPrintSpecificer());
+		constexpr MatrixType infinite{ CinMath::RotateXIdentity<4, 4, ValueType>(AngleType{ RadiansType{ std::numeric_limits<ValueType>::infinity() } }) };
+		TEST_ASSERT(std::isnan(infinite.m22) && infinite.m11 == static_cast<ValueType>(1));
+
+		constexpr AngleType manyTurns{ RadiansType{ static_cast<ValueType>(-1000.25) } };
+		constexpr MatrixType reduced{ CinMath::RotateXIdentity<4, 4, ValueType>(manyTurns) };
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(reduced, CinMath::RotateXIdentity<4, 4, ValueType>(AngleType{ RadiansType{ static_cast<ValueType>(-1000.25) } }))));
 	}
-	/* Matrices */
-	std::cout << "\n--MARIX PRINT--\n";
+
+	/* Tables of constants can be placed in static storage without dynamic initialization */
 	{
-		using Matrix4x4Type = CinMath::Matrix<4, 4, ValueType>;
-		const Matrix4x4Type toPrint
+		constexpr AngleType quarterTurn{ RadiansType{ CinMath::Constants::PI<ValueType> * static_cast<ValueType>(0.5) } };
+		static constinit const MatrixType s_Rotations[]
 		{
-			randomfloat(), randomfloat(), randomfloat(), randomfloat(),
-			randomfloat(), randomfloat(), randomfloat(), randomfloat(),
-			randomfloat(), randomfloat(), randomfloat(), randomfloat(),
-			randomfloat(), randomfloat(), randomfloat(), randomfloat()
+			CinMath::RotateXIdentity<4, 4, ValueType>(quarterTurn),
+			CinMath::RotateYIdentity<4, 4, ValueType>(quarterTurn),
+			CinMath::RotateZIdentity<4, 4, ValueType>(quarterTurn)
 		};
 
-		std::cout << "std-out\n";
-		std::cout << toPrint;
-		std::cout << "std-out-default\n";
-		std::cout << MatrixPrinter(toPrint, DefaultMatrixPrintSpecificer());
-		std::cout << "std-out-thick\n";
-		std::cout << MatrixPrinter(toPrint, ThickMatrixPrintSpecificer());
-		std::cout << "std-out-naked\n";
-		std::cout << MatrixPrinter(toPrint, NakedMatrixPrintSpecificer());
+		const CinMath::Vector<4, ValueType> unitY{ static_cast<ValueType>(0), static_cast<ValueType>(1), static_cast<ValueType>(0), static_cast<ValueType>(0) };
+		const CinMath::Vector<4, ValueType> rotated{ s_Rotations[0] * unitY };
+		TEST_ASSERT(Approximate(rotated.y, static_cast<ValueType>(0)));
+		TEST_ASSERT(Approximate(std::abs(rotated.z), static_cast<ValueType>(1)));
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(s_Rotations[2], CinMath::RotateZIdentity<4, 4, ValueType>(AngleType{ RadiansType{ CinMath::Constants::PI<ValueType> * static_cast<ValueType>(0.5) } }))));
 	}
+
+	/* Decompose and Compose */
 	{
-		using Matrix3x3Type = CinMath::Matrix<3, 3, ValueType>;
-		constexpr Matrix3x3Type toPrint
+		using MatrixType = CinMath::Matrix<4, 4, ValueType>;
+		using Vector3Type = CinMath::Vector<3, ValueType>;
+		using Vector4Type = CinMath::Vector<4, ValueType>;
+		using QuaternionType = CinMath::TQuaternion<ValueType>;
+
+		const auto approximateVector
 		{
-			11, 12, 13,
-			21, 22, 23,
-			31, 32, 33
+			[](const Vector3Type& lhs, const Vector3Type& rhs) noexcept
+			{
+				return Approximate(lhs.x, rhs.x) && Approximate(lhs.y, rhs.y) && Approximate(lhs.z, rhs.z);
+			}
+		};
+		/* q and -q are the same rotation */
+		const auto sameRotation
+		{
+			[](const QuaternionType& lhs, const QuaternionType& rhs) noexcept
+			{
+				const ValueType dot{ lhs.scalar * rhs.scalar + CinMath::Dot(lhs.vector, rhs.vector) };
+				return Approximate(std::abs(dot), static_cast<ValueType>(1));
+			}
+		};
+		const auto axisAngle
+		{
+			[](const Vector3Type& axis, const ValueType angle) noexcept
+			{
+				return QuaternionType{ std::cos(angle * static_cast<ValueType>(0.5)), CinMath::Normalize(axis) * std::sin(angle * static_cast<ValueType>(0.5)) };
+			}
 		};
 
-		std::cout << "std-out\n";
-		std::cout << toPrint;
-		std::cout << "std-out-default\n";
-		std::cout << MatrixPrinter(toPrint, DefaultMatrixPrintSpecificer());
-		std::cout << "std-out-thick\n";
-		std::cout << MatrixPrinter(toPrint, ThickMatrixPrintSpecificer());
-		std::cout << "std-out-naked\n";
-		std::cout << MatrixPrinter(toPrint, NakedMatrixPrintSpecificer());
+		const Vector3Type translation{ static_cast<ValueType>(1), static_cast<ValueType>(-2), static_cast<ValueType>(3) };
+		const Vector3Type scale{ static_cast<ValueType>(2), static_cast<ValueType>(0.5), static_cast<ValueType>(3) };
+		const Vector3Type point{ static_cast<ValueType>(0.25), static_cast<ValueType>(-1), static_cast<ValueType>(2) };
+
+		/* Small and large angles about every axis, the angles near pi reach each branch of Shepperd's method */
+		constexpr ValueType nearHalfTurn{ CinMath::Constants::PI<ValueType> * static_cast<ValueType>(0.99) };
+		const std::array<QuaternionType, 6> rotations
+		{
+			axisAngle(Vector3Type{ static_cast<ValueType>(1), static_cast<ValueType>(2), static_cast<ValueType>(3) }, static_cast<ValueType>(0.3)),
+			axisAngle(Vector3Type{ static_cast<ValueType>(1), static_cast<ValueType>(0), static_cast<ValueType>(0) }, nearHalfTurn),
+			axisAngle(Vector3Type{ static_cast<ValueType>(0), static_cast<ValueType>(1), static_cast<ValueType>(0) }, nearHalfTurn),
+			axisAngle(Vector3Type{ static_cast<ValueType>(0), static_cast<ValueType>(0), static_cast<ValueType>(1) }, nearHalfTurn),
+			axisAngle(Vector3Type{ static_cast<ValueType>(-1), static_cast<ValueType>(1), static_cast<ValueType>(1) }, CinMath::Constants::PI<ValueType>),
+			QuaternionType{ static_cast<ValueType>(1), Vector3Type{ static_cast<ValueType>(0) } }
+		};
+
+		for (const QuaternionType& rotation : rotations)
+		{
+			const MatrixType matrix{ CinMath::Compose(translation, rotation, scale) };
+			const Vector4Type transformed{ matrix * Vector4Type{ point.x, point.y, point.z, static_cast<ValueType>(1) } };
+			TEST_ASSERT(approximateVector(Vector3Type{ transformed.x, transformed.y, transformed.z }, translation + CinMath::Rotate(scale * point, rotation)));
+
+			Vector3Type decomposedTranslation;
+			QuaternionType decomposedRotation;
+			Vector3Type decomposedScale;
+			CinMath::Decompose(matrix, decomposedTranslation, decomposedRotation, decomposedScale);
+			TEST_ASSERT(decomposedTranslation == translation);
+			TEST_ASSERT(approximateVector(decomposedScale, scale));
+			TEST_ASSERT(sameRotation(decomposedRotation, rotation));
+			TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(CinMath::Compose(decomposedTranslation, decomposedRotation, decomposedScale), matrix)));
+
+			const MatrixType rigid{ CinMath::Compose(translation, rotation, Vector3Type{ static_cast<ValueType>(1) }) };
+			CinMath::DecomposeOrthonormal(rigid, decomposedTranslation, decomposedRotation);
+			TEST_ASSERT(decomposedTranslation == translation);
+			TEST_ASSERT(sameRotation(decomposedRotation, rotation));
+		}
+
+		/* A mirror is folded into a negative x scale */
+		{
+			const Vector3Type mirrored{ static_cast<ValueType>(2), static_cast<ValueType>(-0.5), static_cast<ValueType>(3) };
+			const MatrixType matrix{ CinMath::Compose(translation, rotations[0], mirrored) };
+
+			Vector3Type decomposedTranslation;
+			QuaternionType decomposedRotation;
+			Vector3Type decomposedScale;
+			CinMath::Decompose(matrix, decomposedTranslation, decomposedRotation, decomposedScale);
+			TEST_ASSERT(decomposedScale.x < static_cast<ValueType>(0) && decomposedScale.y > static_cast<ValueType>(0) && decomposedScale.z > static_cast<ValueType>(0));
+			TEST_ASSERT(Approximate(CinMath::Length(decomposedRotation.vector) * CinMath::Length(decomposedRotation.vector) + decomposedRotation.scalar * decomposedRotation.scalar, static_cast<ValueType>(1)));
+			TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(CinMath::Compose(decomposedTranslation, decomposedRotation, decomposedScale), matrix)));
+		}
+	}
+}
+
+template<typename ValueType>
+static void TestMemory() noexcept
+{
+	using MatrixType = CinMath::Matrix<4, 4, ValueType>;
+	using Vector4Type = CinMath::Vector<4, ValueType>;
+
+	/* Aligned arrays */
+	{
+		CinMath::Array<MatrixType> matrices;
+		for (std::size_t i{ 0U }; i < 33U; ++i)
+		{
+			matrices.push_back(MatrixType::Identity() * static_cast<ValueType>(i));
+			TEST_ASSERT(CinMath::IsAligned(matrices.data()));
+		}
+
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < matrices.size(); ++i)
+			success &= CinMath::IsAligned<alignof(MatrixType)>(&matrices[i]) && matrices[i][0] == static_cast<ValueType>(i);
+
+		TEST_ASSERT(success);
 	}
+
+	/* Over-aligned arrays */
 	{
-		using Matrix2x2Type = CinMath::Matrix<2, 2, ValueType>;
-		constexpr Matrix2x2Type toPrint
+		CinMath::Array<Vector4Type, 64U> vectors(7U, Vector4Type{ static_cast<ValueType>(1) });
+		TEST_ASSERT(CinMath::IsAligned<64U>(vectors.data()));
+		TEST_ASSERT(vectors[6].w == static_cast<ValueType>(1));
+
+		CinMath::Array<Vector4Type, 64U> moved{ std::move(vectors) };
+		TEST_ASSERT(CinMath::IsAligned<64U>(moved.data()) && moved.size() == 7U);
+	}
+
+	/* Rebinding keeps the alignment */
+	{
+		using Rebound = typename std::allocator_traits<CinMath::AlignedAllocator<MatrixType>>::template rebind_alloc<char>;
+		TEST_ASSERT(Rebound::alignment == CinMath::SIMDAlignment);
+
+		Rebound allocator;
+		char* const bytes{ allocator.allocate(3U) };
+		TEST_ASSERT(CinMath::IsAligned(bytes));
+		allocator.deallocate(bytes, 3U);
+	}
+
+	/* Frame arena */
+	{
+		CinMath::FrameArena arena{ 1024U };
+		MatrixType* const matrices{ arena.Allocate<MatrixType>(2U) };
+		TEST_ASSERT(matrices != nullptr && CinMath::IsAligned(matrices));
+
+		char* const byte{ static_cast<char*>(arena.Allocate(1U, 1U)) };
+		Vector4Type* const vectors{ arena.Allocate<Vector4Type>(3U) };
+		TEST_ASSERT(byte != nullptr && CinMath::IsAligned(vectors) && reinterpret_cast<char*>(vectors) > byte);
+
+		/* Exhaustion is reported, not thrown */
+		TEST_ASSERT(arena.Allocate<MatrixType>(1024U) == nullptr);
+
+		const CinMath::FrameArena::Marker marker{ arena.GetMarker() };
 		{
-			11, 12,
-			21, 22
-		};
+			CinMath::FrameArenaScope scope{ arena };
+			static_cast<void>(arena.Allocate(100U));
+			TEST_ASSERT(arena.GetUsed() > marker);
+		}
+		TEST_ASSERT(arena.GetUsed() == marker);
 
-		std::cout << "std-out\n";
-		std::cout << toPrint;
-		std::cout << "std-out-default\n";
-		std::cout << MatrixPrinter(toPrint, DefaultMatrixPrintSpecificer());
-		std::cout << "std-out-thick\n";
-		std::cout << MatrixPrinter(toPrint, ThickMatrixPrintSpecificer());
-		std::cout << "std-out-naked\n";
-		std::cout << MatrixPrinter(toPrint, NakedMatrixPrintSpecificer());
+		arena.Reset();
+		TEST_ASSERT(arena.GetUsed() == 0U && arena.Allocate<MatrixType>(2U) == matrices);
 	}
-	std::cout << "--PRINT QUATERNION--";
+
+	/* Containers backed by a frame arena */
 	{
-		using QuaternionType = CinMath::TQuaternion<ValueType>;
-		constexpr QuaternionType quat{ static_cast<ValueType>(1), static_cast<ValueType>(2), static_cast<ValueType>(3), static_cast<ValueType>(4) };
-		std::cout << quat;
+		CinMath::FrameArena arena{ 64U * 1024U };
+		{
+			CinMath::FrameArray<MatrixType> scratch{ CinMath::ArenaAllocator<MatrixType>{ arena } };
+			for (std::size_t i{ 0U }; i < 16U; ++i)
+				scratch.push_back(MatrixType::Identity() * static_cast<ValueType>(i));
+
+			TEST_ASSERT(CinMath::IsAligned(scratch.data()) && scratch[15][0] == static_cast<ValueType>(15));
+			TEST_ASSERT(arena.GetUsed() >= 16U * sizeof(MatrixType));
+		}
+		arena.Reset();
+
+		bool threw{ false };
+		try
+		{
+			CinMath::FrameArray<MatrixType> tooLarge(2048U, MatrixType::Identity(), CinMath::ArenaAllocator<MatrixType>{ arena });
+		}
+		catch (const std::bad_alloc&)
+		{
+			threw = true;
+		}
+		TEST_ASSERT(threw);
+	}
+
+	/* Every thread owns its arena */
+	{
+		CinMath::FrameArena* const mainArena{ &CinMath::FrameArena::ForCurrentThread() };
+		CinMath::FrameArena* workerArena{ nullptr };
+		std::thread worker{ [&workerArena]() { workerArena = &CinMath::FrameArena::ForCurrentThread(); } };
+		worker.join();
+
+		TEST_ASSERT(mainArena == &CinMath::FrameArena::ForCurrentThread() && workerArena != mainArena);
 	}
 }
-#endif
\ No newline at end of file
+
+template<typename ValueType>
+static void TestBatch() noexcept
+{
+	using MatrixType = CinMath::Matrix<4, 4, ValueType>;
+	using Vector3Type = CinMath::Vector<3, ValueType>;
+	using Vector4Type = CinMath::Vector<4, ValueType>;
+	using QuaternionType = CinMath::TQuaternion<ValueType>;
+
+	constexpr std::size_t count{ 10'000U };
+	const auto value
+	{
+		[](const std::size_t i, const std::size_t j) -> ValueType
+		{
+			return static_cast<ValueType>(static_cast<int>((i * 7U + j * 13U) % 19U) - 9) * static_cast<ValueType>(0.25);
+		}
+	};
+
+	CinMath::Array<MatrixType> lhs;
+	CinMath::Array<MatrixType> rhs;
+	CinMath::Array<Vector4Type> points;
+	CinMath::Array<Vector3Type> directions;
+	for (std::size_t i{ 0U }; i < count; ++i)
+	{
+		std::array<ValueType, 16> elements{};
+		for (std::size_t j{ 0U }; j < 16U; ++j)
+			elements[j] = value(i, j);
+
+		lhs.push_back(MatrixType{ std::move(elements) });
+		rhs.push_back(lhs.back() * value(i, 1U) + MatrixType::Identity());
+		points.push_back(Vector4Type{ value(i, 0U), value(i, 1U), value(i, 2U), static_cast<ValueType>(1) });
+		directions.push_back(Vector3Type{ value(i, 3U), value(i, 4U), value(i, 5U) });
+	}
+
+	CinMath::ThreadPool pool{ 3U };
+
+	/* Matrix products */
+	{
+		CinMath::Array<MatrixType> serial(count, MatrixType{});
+		CinMath::Array<MatrixType> parallel(count, MatrixType{});
+		CinMath::MultiplyArray(lhs.data(), rhs.data(), serial.data(), count);
+		CinMath::Parallel::MultiplyArray(pool, lhs.data(), rhs.data(), parallel.data(), count);
+
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < count; ++i)
+			success &= serial[i] == lhs[i] * rhs[i] && parallel[i] == serial[i];
+		TEST_ASSERT(success);
+
+		CinMath::Parallel::MultiplyArray(pool, lhs[7], rhs.data(), parallel.data(), count);
+		success = true;
+		for (std::size_t i{ 0U }; i < count; ++i)
+			success &= parallel[i] == lhs[7] * rhs[i];
+		TEST_ASSERT(success);
+	}
+
+	/* Normalization, array of structures and structure of arrays (odd count covers the remainder loops) */
+	{
+		constexpr std::size_t normalCount{ 1'003U };
+		const ValueType tolerance{ static_cast<ValueType>(1e-5) };
+
+		CinMath::Array<Vector4Type> normalized(normalCount, Vector4Type{});
+		CinMath::Array<Vector4Type> normalizedFast(normalCount, Vector4Type{});
+		CinMath::NormalizeArray(points.data(), normalized.data(), normalCount);
+		CinMath::NormalizeArrayFast(points.data(), normalizedFast.data(), normalCount);
+
+		CinMath::Array<ValueType> x(normalCount), y(normalCount), z(normalCount);
+		CinMath::Array<ValueType> xFast(normalCount), yFast(normalCount), zFast(normalCount);
+		for (std::size_t i{ 0U }; i < normalCount; ++i)
+		{
+			xFast[i] = x[i] = directions[i].x;
+			yFast[i] = y[i] = directions[i].y;
+			zFast[i] = z[i] = directions[i].z;
+		}
+		CinMath::NormalizeArray(x.data(), y.data(), z.data(), normalCount);
+		CinMath::NormalizeArrayFast(xFast.data(), yFast.data(), zFast.data(), normalCount);
+
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < normalCount; ++i)
+		{
+			const ValueType length{ std::sqrt(CinMath::Dot(points[i], points[i])) };
+			success &= std::abs(CinMath::Length(points[i]) - length) <= tolerance * length;
+			success &= std::abs(CinMath::Length(normalized[i]) - static_cast<ValueType>(1)) <= tolerance;
+			success &= std::abs(CinMath::Length(normalizedFast[i]) - static_cast<ValueType>(1)) <= tolerance;
+			success &= std::abs(normalized[i].x * length - points[i].x) <= tolerance * length;
+
+			const Vector3Type expected{ CinMath::Normalize(directions[i]) };
+			success &= std::abs(x[i] - expected.x) <= tolerance && std::abs(y[i] - expected.y) <= tolerance && std::abs(z[i] - expected.z) <= tolerance;
+			success &= std::abs(xFast[i] - expected.x) <= tolerance && std::abs(yFast[i] - expected.y) <= tolerance && std::abs(zFast[i] - expected.z) <= tolerance;
+		}
+		TEST_ASSERT(success);
+
+		/* In place */
+		CinMath::Array<Vector4Type> inPlace{ points.begin(), points.begin() + normalCount };
+		CinMath::NormalizeArray(inPlace.data(), inPlace.data(), normalCount);
+		TEST_ASSERT(std::equal(inPlace.begin(), inPlace.end(), normalized.begin()));
+	}
+
+	/* Point transformation */
+	{
+		CinMath::Array<Vector4Type> serial(count, Vector4Type{});
+		CinMath::Array<Vector4Type> parallel(count, Vector4Type{});
+		CinMath::TransformPoints(lhs[3], points.data(), serial.data(), count);
+		CinMath::Parallel::TransformPoints(pool, lhs[3], points.data(), parallel.data(), count);
+
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < count; ++i)
+			success &= serial[i] == lhs[3] * points[i] && parallel[i] == serial[i];
+		TEST_ASSERT(success);
+	}
+
+	/* Row vector convention, the inputs are exact in both value types so every summation order agrees */
+	{
+		CinMath::Array<Vector4Type> transposed(count, Vector4Type{});
+		CinMath::Array<Vector4Type> expected(count, Vector4Type{});
+		/* Odd count, leaves a single vector for the remainder path */
+		CinMath::TransformPointsTransposed(lhs[5], points.data(), transposed.data(), count - 1U);
+		CinMath::TransformPoints(CinMath::Transpose(lhs[5]), points.data(), expected.data(), count - 1U);
+
+		bool success{ true };
+		for (std::size_t i{ 0U }; i + 1U < count; ++i)
+			success &= transposed[i] == points[i] * lhs[5] && transposed[i] == expected[i];
+		TEST_ASSERT(success);
+		TEST_ASSERT(transposed[count - 1U] == Vector4Type{});
+	}
+
+	/* Lane layout, a partial last block is padded with identity matrices */
+	{
+		constexpr std::size_t partial{ 8U * 37U + 5U };
+		CinMath::Array<ValueType> lanes(CinMath::MatrixLanesLength(partial), static_cast<ValueType>(-1));
+		TEST_ASSERT(lanes.size() == 38U * 128U);
+		CinMath::TransposeArray(lhs.data(), lanes.data(), partial);
+
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < lanes.size() / 16U; ++i)
+			for (std::size_t element{ 0U }; element < 16U; ++element)
+				success &= lanes[i / 8U * 128U + element * 8U + i % 8U] == (i < partial ? lhs[i].raw[element] : MatrixType::Identity().raw[element]);
+		TEST_ASSERT(success);
+
+		CinMath::Array<MatrixType> roundTrip(partial + 1U, MatrixType{ static_cast<ValueType>(7) });
+		CinMath::TransposeArray(lanes.data(), roundTrip.data(), partial);
+		success = true;
+		for (std::size_t i{ 0U }; i < partial; ++i)
+			success &= roundTrip[i] == lhs[i];
+		TEST_ASSERT(success);
+		TEST_ASSERT(roundTrip[partial] == MatrixType{ static_cast<ValueType>(7) });
+	}
+
+	/* Quaternion rotation */
+	{
+		const ValueType halfAngle{ CinMath::Constants::PI<ValueType> * static_cast<ValueType>(0.25) };
+		const QuaternionType rotation{ std::cos(halfAngle), Vector3Type{ static_cast<ValueType>(0), static_cast<ValueType>(0), std::sin(halfAngle) } };
+
+		const Vector3Type rotated{ CinMath::Rotate(Vector3Type{ static_cast<ValueType>(1), static_cast<ValueType>(0), static_cast<ValueType>(0) }, rotation) };
+		TEST_ASSERT(Approximate(rotated.x, static_cast<ValueType>(0)) && Approximate(rotated.y, static_cast<ValueType>(1)) && Approximate(rotated.z, static_cast<ValueType>(0)));
+
+		CinMath::Array<Vector3Type> serial(count, Vector3Type{});
+		CinMath::Array<Vector3Type> parallel(count, Vector3Type{});
+		CinMath::RotateArray(rotation, directions.data(), serial.data(), count);
+		CinMath::Parallel::RotateArray(pool, rotation, directions.data(), parallel.data(), count);
+
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < count; ++i)
+			success &= Approximate(serial[i].x, -directions[i].y) && Approximate(serial[i].y, directions[i].x) && Approximate(serial[i].z, directions[i].z) &&
+				parallel[i].x == serial[i].x && parallel[i].y == serial[i].y && parallel[i].z == serial[i].z;
+		TEST_ASSERT(success);
+	}
+
+	/* Frustum culling, a unit box */
+	{
+		const std::array<Vector4Type, 6> planes
+		{
+			Vector4Type{ static_cast<ValueType>(1), static_cast<ValueType>(0), static_cast<ValueType>(0), static_cast<ValueType>(1) },
+			Vector4Type{ static_cast<ValueType>(-1), static_cast<ValueType>(0), static_cast<ValueType>(0), static_cast<ValueType>(1) },
+			Vector4Type{ static_cast<ValueType>(0), static_cast<ValueType>(1), static_cast<ValueType>(0), static_cast<ValueType>(1) },
+			Vector4Type{ static_cast<ValueType>(0), static_cast<ValueType>(-1), static_cast<ValueType>(0), static_cast<ValueType>(1) },
+			Vector4Type{ static_cast<ValueType>(0), static_cast<ValueType>(0), static_cast<ValueType>(1), static_cast<ValueType>(1) },
+			Vector4Type{ static_cast<ValueType>(0), static_cast<ValueType>(0), static_cast<ValueType>(-1), static_cast<ValueType>(1) }
+		};
+
+		CinMath::Array<Vector4Type> spheres;
+		std::size_t expectedVisible{ 0U };
+		for (std::size_t i{ 0U }; i < count; ++i)
+		{
+			const Vector4Type sphere{ value(i, 0U), value(i, 1U), value(i, 2U), static_cast<ValueType>(i % 3U) * static_cast<ValueType>(0.25) };
+			const bool inside
+			{
+				std::abs(sphere.x) <= static_cast<ValueType>(1) + sphere.w &&
+				std::abs(sphere.y) <= static_cast<ValueType>(1) + sphere.w &&
+				std::abs(sphere.z) <= static_cast<ValueType>(1) + sphere.w
+			};
+
+			spheres.push_back(sphere);
+			expectedVisible += inside;
+		}
+
+		std::vector<std::uint8_t> serial(count, 0U);
+		std::vector<std::uint8_t> parallel(count, 0U);
+		const std::size_t serialVisible{ CinMath::CullSpheres(planes, spheres.data(), serial.data(), count) };
+		const std::size_t parallelVisible{ CinMath::Parallel::CullSpheres(pool, planes, spheres.data(), parallel.data(), count) };
+
+		TEST_ASSERT(serialVisible == expectedVisible && parallelVisible == expectedVisible);
+		TEST_ASSERT(serial == parallel);
+
+		/* A NaN distance is never >= 0, the sphere is culled on every tier */
+		const ValueType nan{ std::numeric_limits<ValueType>::quiet_NaN() };
+		const ValueType half{ static_cast<ValueType>(0.5) };
+		const std::array<Vector4Type, 3> nanSpheres
+		{
+			Vector4Type{ nan, static_cast<ValueType>(0), static_cast<ValueType>(0), half },
+			Vector4Type{ static_cast<ValueType>(0), static_cast<ValueType>(0), static_cast<ValueType>(0), nan },
+			Vector4Type{ static_cast<ValueType>(0), static_cast<ValueType>(0), static_cast<ValueType>(0), half }
+		};
+		std::array<std::uint8_t, 3> nanVisibility{ 2U, 2U, 2U };
+		TEST_ASSERT(CinMath::CullSpheres(planes, nanSpheres.data(), nanVisibility.data(), nanSpheres.size()) == 1U);
+		TEST_ASSERT(nanVisibility[0] == 0U && nanVisibility[1] == 0U && nanVisibility[2] == 1U);
+
+		std::array<Vector4Type, 6> nanPlanes{ planes };
+		nanPlanes[4].w = nan;
+		TEST_ASSERT(CinMath::CullSpheres(nanPlanes, nanSpheres.data() + 2U, nanVisibility.data(), 1U) == 0U && nanVisibility[0] == 0U);
+	}
+
+	/* Execution policies */
+	{
+		CinMath::Array<Vector4Type> serial(count, Vector4Type{});
+		CinMath::Array<Vector4Type> parallel(count, Vector4Type{});
+		CinMath::TransformPoints(lhs[3], points.data(), serial.data(), count);
+		CinMath::TransformPoints(std::execution::par_unseq, lhs[3], points.data(), parallel.data(), count);
+		TEST_ASSERT(serial == parallel);
+
+		CinMath::NormalizeArray(std::execution::par, points.data(), parallel.data(), count);
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < count; ++i)
+			success &= Approximate(CinMath::Length(parallel[i]), static_cast<ValueType>(1));
+		TEST_ASSERT(success);
+
+		ValueType expectedDot{ static_cast<ValueType>(0) };
+		for (std::size_t i{ 0U }; i < count; ++i)
+			expectedDot += CinMath::Dot(points[i], serial[i]);
+
+		const ValueType dot{ CinMath::DotReduce(std::execution::par_unseq, points.data(), serial.data(), count) };
+		TEST_ASSERT(std::abs(dot - expectedDot) <= std::abs(expectedDot) * static_cast<ValueType>(1e-4));
+
+		/* Vectors reduce like arithmetic types */
+		const Vector4Type sum{ std::transform_reduce(std::execution::par_unseq, points.begin(), points.end(), Vector4Type{}, std::plus<>{},
+			[](const Vector4Type& point) noexcept { return point * static_cast<ValueType>(2); }) };
+		TEST_ASSERT(Approximate(sum.w, static_cast<ValueType>(2 * count)));
+
+		/* Rotations about one axis commute, so the ordered chain can be checked against the total angle */
+		const ValueType step{ static_cast<ValueType>(0.001) };
+		const MatrixType rotation{ CinMath::RotateZIdentity<4, 4, ValueType>(CinMath::TAngle<ValueType>{ CinMath::TRadians<ValueType>{ step } }) };
+		const CinMath::Array<MatrixType> chain(count, rotation);
+		const MatrixType product{ CinMath::MultiplyChain(std::execution::par, chain.data(), count) };
+		const MatrixType expected{ CinMath::RotateZIdentity<4, 4, ValueType>(CinMath::TAngle<ValueType>{ CinMath::TRadians<ValueType>{ step * static_cast<ValueType>(count) } }) };
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(product, expected)));
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(product, CinMath::MultiplyChain(chain.data(), count))));
+
+		/* Non commuting chain must keep its order */
+		const MatrixType a{ CinMath::TranslateIdentity<4, 4, ValueType>(Vector3Type{ static_cast<ValueType>(1), static_cast<ValueType>(0), static_cast<ValueType>(0) }) };
+		CinMath::Array<MatrixType> ordered(1000U, MatrixType::Identity());
+		ordered[10] = a;
+		ordered[900] = CinMath::RotateZIdentity<4, 4, ValueType>(CinMath::TAngle<ValueType>{ CinMath::TRadians<ValueType>{ static_cast<ValueType>(0.5) } });
+		TEST_ASSERT((ApproximateMatrix<4, 4, ValueType>(CinMath::MultiplyChain(std::execution::par, ordered.data(), ordered.size()), a * ordered[900])));
+		TEST_ASSERT(!(ApproximateMatrix<4, 4, ValueType>(a * ordered[900], ordered[900] * a)));
+	}
+
+	/* Every index is visited exactly once */
+	{
+		std::vector<std::atomic<int>> visits(count);
+		CinMath::ParallelFor(pool, count, 37U, [&visits](const std::size_t begin, const std::size_t end) noexcept
+		{
+			for (std::size_t i{ begin }; i < end; ++i)
+				visits[i].fetch_add(1, std::memory_order_relaxed);
+		});
+
+		bool success{ true };
+		for (const std::atomic<int>& visit : visits)
+			success &= visit.load() == 1;
+		TEST_ASSERT(success);
+	}
+}
+
+#if TEST_PRINTING
+template<typename ValueType>
+void TestPrinting() noexcept
+{
+	using namespace CinMath::Printing;
+
+	const auto randomfloat
+	{
+		[]() -> float
+		{
+			return static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+		}
+	};
+	/* Vectors */
+	std::cout << "\n--VECTOR PRINT--\n";
+	{
+		using Vector4Type = CinMath::Vector<4, ValueType>;
+		constexpr Vector4Type toPrint{ 1, 2, 3, 4 };
+
+		std::cout << "std-out\n";
+		std::cout << toPrint;
+		std::cout << "std-out-default\n";
+		std::cout << VectorPrinter(toPrint, DefaultVectorPrintSpecificer());
+		std::cout << "std-out-round\n";
+		std::cout << VectorPrinter(toPrint, RoundVectorPrintSpecificer());
+		std::cout << "std-out-curly\n";
+		std::cout << VectorPrinter(toPrint, CurlyVectorPrintSpecificer());
+	}
+	{
+		using Vector4Type = CinMath::Vector<3, ValueType>;
+		constexpr Vector4Type toPrint{ 1, 2, 3 };
+
+		std::cout << "std-out\n";
+		std::cout << toPrint;
+		std::cout << "std-out-default\n";
+		std::cout << VectorPrinter(toPrint, DefaultVectorPrintSpecificer());
+		std::cout << "std-out-round\n";
+		std::cout << VectorPrinter(toPrint, RoundVectorPrintSpecificer());
+		std::cout << "std-out-curly\n";
+		std::cout << VectorPrinter(toPrint, CurlyVectorPrintSpecificer());
+	}
+	{
+		using Vector4Type = CinMath::Vector<2, ValueType>;
+		constexpr Vector4Type toPrint{ 1, 2 };
+
+		std::cout << "std-out\n";
+		std::cout << toPrint;
+		std::cout << "std-out-default\n";
+		std::cout << VectorPrinter(toPrint, DefaultVectorPrintSpecificer());
+		std::cout << "std-out-round\n";
+		std::cout << VectorPrinter(toPrint, RoundVectorPrintSpecificer());
+		std::cout << "std-out-curly\n";
+		std::cout << VectorPrinter(toPrint, CurlyVectorPrintSpecificer());
+	}
+	/* Matrices */
+	std::cout << "\n--MARIX PRINT--\n";
+	{
+		using Matrix4x4Type = CinMath::Matrix<4, 4, ValueType>;
+		const Matrix4x4Type toPrint
+		{
+			randomfloat(), randomfloat(), randomfloat(), randomfloat(),
+			randomfloat(), randomfloat(), randomfloat(), randomfloat(),
+			randomfloat(), randomfloat(), randomfloat(), randomfloat(),
+			randomfloat(), randomfloat(), randomfloat(), randomfloat()
+		};
+
+		std::cout << "std-out\n";
+		std::cout << toPrint;
+		std::cout << "std-out-default\n";
+		std::cout << MatrixPrinter(toPrint, DefaultMatrixPrintSpecificer());
+		std::cout << "std-out-thick\n";
+		std::cout << MatrixPrinter(toPrint, ThickMatrixPrintSpecificer());
+		std::cout << "std-out-naked\n";
+		std::cout << MatrixPrinter(toPrint, NakedMatrixPrintSpecificer());
+	}
+	{
+		using Matrix3x3Type = CinMath::Matrix<3, 3, ValueType>;
+		constexpr Matrix3x3Type toPrint
+		{
+			11, 12, 13,
+			21, 22, 23,
+			31, 32, 33
+		};
+
+		std::cout << "std-out\n";
+		std::cout << toPrint;
+		std::cout << "std-out-default\n";
+		std::cout << MatrixPrinter(toPrint, DefaultMatrixPrintSpecificer());
+		std::cout << "std-out-thick\n";
+		std::cout << MatrixPrinter(toPrint, ThickMatrixPrintSpecificer());
+		std::cout << "std-out-naked\n";
+		std::cout << MatrixPrinter(toPrint, NakedMatrixPrintSpecificer());
+	}
+	{
+		using Matrix2x2Type = CinMath::Matrix<2, 2, ValueType>;
+		constexpr Matrix2x2Type toPrint
+		{
+			11, 12,
+			21, 22
+		};
+
+		std::cout << "std-out\n";
+		std::cout << toPrint;
+		std::cout << "std-out-default\n";
+		std::cout << MatrixPrinter(toPrint, DefaultMatrixPrintSpecificer());
+		std::cout << "std-out-thick\n";
+		std::cout << MatrixPrinter(toPrint, ThickMatrixPrintSpecificer());
+		std::cout << "std-out-naked\n";
+		std::cout << MatrixPrinter(toPrint, NakedMatrixPrintSpecificer());
+	}
+	std::cout << "--PRINT QUATERNION--";
+	{
+		using QuaternionType = CinMath::TQuaternion<ValueType>;
+		constexpr QuaternionType quat{ static_cast<ValueType>(1), static_cast<ValueType>(2), static_cast<ValueType>(3), static_cast<ValueType>(4) };
+		std::cout << quat;
+	}
+}
+#endif
+
+template<typename ValueType>
+static void TestMatrix4SoA() noexcept
+{
+	using MatrixType = CinMath::Matrix<4, 4, ValueType>;
+	using Vector4Type = CinMath::Vector<4, ValueType>;
+
+	/* Multiples of 0.25 with small products, every summation order gives the same bits */
+	constexpr std::size_t count{ 8U * 64U + 3U };
+	CinMath::Array<MatrixType> lhs;
+	CinMath::Array<MatrixType> rhs;
+	CinMath::Array<Vector4Type> points;
+	for (std::size_t i{ 0U }; i < count; ++i)
+	{
+		std::array<ValueType, 16> elements{};
+		for (std::size_t j{ 0U }; j < 16U; ++j)
+			elements[j] = static_cast<ValueType>(static_cast<int>((i * 7U + j * 13U) % 19U) - 9) * static_cast<ValueType>(0.25);
+
+		lhs.push_back(MatrixType{ std::move(elements) });
+		/* Diagonally dominant, far from singular */
+		rhs.push_back(lhs.back() + MatrixType{ static_cast<ValueType>(16) });
+		points.push_back(Vector4Type{ lhs.back().raw[1], lhs.back().raw[2], lhs.back().raw[3], static_cast<ValueType>(1) });
+	}
+
+	CinMath::Array<ValueType> lhsLanes(CinMath::MatrixLanesLength(count));
+	CinMath::Array<ValueType> rhsLanes(CinMath::MatrixLanesLength(count));
+	CinMath::TransposeArray(lhs.data(), lhsLanes.data(), count);
+	CinMath::TransposeArray(rhs.data(), rhsLanes.data(), count);
+
+	/* Lane access and the identity padding of the last block */
+	{
+		const CinMath::Matrix4SoA block{ CinMath::Matrix4SoA::Load(lhsLanes.data() + 8U * 16U) };
+		TEST_ASSERT(block.Get(3U) == lhs[11]);
+
+		const CinMath::Matrix4SoA last{ CinMath::Matrix4SoA::Load(lhsLanes.data() + 64U * 8U * 16U) };
+		TEST_ASSERT(last.Get(2U) == lhs[count - 1U] && last.Get(3U) == MatrixType::Identity() && last.Get(7U) == MatrixType::Identity());
+
+		CinMath::Matrix4SoA identity{ CinMath::Matrix4SoA::Identity() };
+		identity.Set(5U, lhs[0]);
+		TEST_ASSERT(identity.Get(5U) == lhs[0] && identity.Get(4U) == MatrixType::Identity());
+
+		std::array<ValueType, 128> stored{};
+		block.Store(stored.data());
+		TEST_ASSERT(std::equal(stored.begin(), stored.end(), lhsLanes.begin() + 8U * 16U));
+	}
+
+	bool products{ true };
+	bool transforms{ true };
+	bool transposes{ true };
+	bool determinants{ true };
+	bool inverses{ true };
+	for (std::size_t block{ 0U }; block * 8U < count; ++block)
+	{
+		const CinMath::Matrix4SoA a{ CinMath::Matrix4SoA::Load(lhsLanes.data() + block * 128U) };
+		const CinMath::Matrix4SoA b{ CinMath::Matrix4SoA::Load(rhsLanes.data() + block * 128U) };
+		const CinMath::Matrix4SoA product{ a * b };
+		const CinMath::Matrix4SoA transposed{ CinMath::Transpose(a) };
+		const CinMath::ScalarSoA determinant{ CinMath::Determinant(b) };
+		const CinMath::Matrix4SoA inverse{ CinMath::Inverse(b) };
+
+		CinMath::Vector4SoA vectors;
+		for (std::size_t lane{ 0U }; lane < 8U && block * 8U + lane < count; ++lane)
+			vectors.Set(lane, points[block * 8U + lane]);
+		const CinMath::Vector4SoA transformed{ a * vectors };
+
+		for (std::size_t lane{ 0U }; lane < 8U && block * 8U + lane < count; ++lane)
+		{
+			const std::size_t i{ block * 8U + lane };
+			products &= product.Get(lane) == lhs[i] * rhs[i];
+			transforms &= transformed.Get(lane) == lhs[i] * points[i];
+			transposes &= transposed.Get(lane) == CinMath::Transpose(lhs[i]);
+			determinants &= Approximate(determinant.raw[lane] / CinMath::Determinant(rhs[i]), static_cast<ValueType>(1));
+			inverses &= ApproximateMatrix(inverse.Get(lane) * rhs[i], MatrixType::Identity());
+		}
+	}
+
+	TEST_ASSERT(products);
+	TEST_ASSERT(transforms);
+	TEST_ASSERT(transposes);
+	TEST_ASSERT(determinants);
+	TEST_ASSERT(inverses);
+
+	/* A singular lane does not disturb its neighbours */
+	{
+		CinMath::Matrix4SoA matrices{ CinMath::Matrix4SoA::Identity() };
+		matrices.Set(1U, MatrixType{});
+		matrices.Set(2U, rhs[0]);
+		const CinMath::Matrix4SoA inverse{ CinMath::Inverse(matrices) };
+		TEST_ASSERT(inverse.Get(0U) == MatrixType::Identity());
+		TEST_ASSERT(ApproximateMatrix(inverse.Get(2U) * rhs[0], MatrixType::Identity()));
+		TEST_ASSERT(CinMath::Determinant(matrices).raw[1] == static_cast<ValueType>(0));
+	}
+
+	/* Decompose of the lanes agrees with the scalar Decompose, whichever branch of Shepperd's method each lane takes */
+	{
+		using Vector3Type = CinMath::Vector<3, ValueType>;
+		using QuaternionType = CinMath::TQuaternion<ValueType>;
+
+		constexpr std::size_t decomposeCount{ 8U * 4U + 5U };
+		CinMath::Array<MatrixType> transforms;
+		for (std::size_t i{ 0U }; i < decomposeCount; ++i)
+		{
+			const ValueType angle{ static_cast<ValueType>(i) * static_cast<ValueType>(0.37) };
+			const Vector3Type axis{ CinMath::Normalize(Vector3Type{ static_cast<ValueType>(i % 3U == 0U), static_cast<ValueType>(i % 3U == 1U), static_cast<ValueType>(1 + i % 2U) }) };
+			const QuaternionType rotation{ std::cos(angle), axis * std::sin(angle) };
+			const Vector3Type scale{ static_cast<ValueType>(1 + i % 4U), static_cast<ValueType>(i % 5U == 0U ? -2 : 1), static_cast<ValueType>(0.5) };
+			transforms.push_back(CinMath::Compose(Vector3Type{ static_cast<ValueType>(i), static_cast<ValueType>(1), -static_cast<ValueType>(i) }, rotation, scale));
+		}
+
+		CinMath::Array<Vector3Type> translations(decomposeCount);
+		CinMath::Array<QuaternionType> rotations(decomposeCount);
+		CinMath::Array<Vector3Type> scales(decomposeCount);
+		CinMath::DecomposeArray(transforms.data(), translations.data(), rotations.data(), scales.data(), decomposeCount);
+
+		bool decomposed{ true };
+		bool composed{ true };
+		for (std::size_t block{ 0U }; block * 8U < decomposeCount; ++block)
+		{
+			CinMath::Matrix4SoA matrices{ CinMath::Matrix4SoA::Identity() };
+			for (std::size_t lane{ 0U }; lane < 8U && block * 8U + lane < decomposeCount; ++lane)
+				matrices.Set(lane, transforms[block * 8U + lane]);
+
+			CinMath::Vector3SoA translation;
+			CinMath::QuaternionSoA rotation;
+			CinMath::Vector3SoA scale;
+			CinMath::Decompose(matrices, translation, rotation, scale);
+			const CinMath::Matrix4SoA recomposed{ CinMath::Compose(translation, rotation, scale) };
+
+			for (std::size_t lane{ 0U }; lane < 8U && block * 8U + lane < decomposeCount; ++lane)
+			{
+				const std::size_t i{ block * 8U + lane };
+				Vector3Type expectedTranslation;
+				QuaternionType expectedRotation;
+				Vector3Type expectedScale;
+				CinMath::Decompose(transforms[i], expectedTranslation, expectedRotation, expectedScale);
+
+				const QuaternionType actual{ rotation.Get(lane) };
+				decomposed &= translation.Get(lane) == expectedTranslation && translations[i] == expectedTranslation;
+				decomposed &= Approximate(scale.Get(lane).x, expectedScale.x) && Approximate(scale.Get(lane).y, expectedScale.y) && Approximate(scale.Get(lane).z, expectedScale.z);
+				decomposed &= Approximate(actual.scalar, expectedRotation.scalar) && Approximate(actual.vector.x, expectedRotation.vector.x) &&
+					Approximate(actual.vector.y, expectedRotation.vector.y) && Approximate(actual.vector.z, expectedRotation.vector.z);
+				decomposed &= rotations[i].scalar == actual.scalar && scales[i].x == scale.Get(lane).x;
+				composed &= ApproximateMatrix(recomposed.Get(lane), transforms[i]);
+			}
+		}
+
+		TEST_ASSERT(decomposed);
+		TEST_ASSERT(composed);
+
+		CinMath::Matrix4SoA rigid{ CinMath::Matrix4SoA::Identity() };
+		const QuaternionType halfTurn{ static_cast<ValueType>(0), Vector3Type{ static_cast<ValueType>(0), static_cast<ValueType>(1), static_cast<ValueType>(0) } };
+		rigid.Set(6U, CinMath::Compose(Vector3Type{ static_cast<ValueType>(4) }, halfTurn, Vector3Type{ static_cast<ValueType>(1) }));
+		CinMath::Vector3SoA translation;
+		CinMath::QuaternionSoA rotation;
+		CinMath::DecomposeOrthonormal(rigid, translation, rotation);
+		TEST_ASSERT(rotation.Get(0U) == (QuaternionType{ static_cast<ValueType>(1), Vector3Type{ static_cast<ValueType>(0) } }));
+		TEST_ASSERT(translation.Get(6U) == Vector3Type{ static_cast<ValueType>(4) } && Approximate(std::abs(rotation.Get(6U).vector.y), static_cast<ValueType>(1)));
+	}
+}
+
+template<typename ValueType>
+static void TestHalf() noexcept
+{
+	using CinMath::Half;
+	const auto roundTrip
+	{
+		[](const ValueType value) noexcept -> ValueType
+		{
+			return static_cast<ValueType>(static_cast<float>(Half{ static_cast<float>(value) }));
+		}
+	};
+
+	/* Exactly representable values */
+	{
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(1)) == static_cast<ValueType>(1));
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(-2)) == static_cast<ValueType>(-2));
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(0.5)) == static_cast<ValueType>(0.5));
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(65504)) == static_cast<ValueType>(65504));
+		/* Smallest subnormal */
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(0x1p-24)) == static_cast<ValueType>(0x1p-24));
+		TEST_ASSERT(Half{ -0.0f }.Bits == 0x8000U && Half{ -0.0f } == Half{ 0.0f });
+	}
+
+	/* Rounding, ties go to the even mantissa */
+	{
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(1 + 0x1p-11)) == static_cast<ValueType>(1));
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(1 + 3 * 0x1p-11)) == static_cast<ValueType>(1 + 0x1p-9));
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(65519)) == static_cast<ValueType>(65504));
+		TEST_ASSERT(std::isinf(roundTrip(static_cast<ValueType>(65520))));
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(0x1p-25)) == static_cast<ValueType>(0));
+		TEST_ASSERT(roundTrip(static_cast<ValueType>(0x1.8p-25)) == static_cast<ValueType>(0x1p-24));
+		TEST_ASSERT(std::isnan(roundTrip(std::numeric_limits<ValueType>::quiet_NaN())));
+	}
+
+	/* Constant evaluation */
+	{
+		constexpr Half half{ 0.25f };
+		static_assert(half.Bits == 0x3400U && static_cast<float>(half) == 0.25f);
+		TEST_ASSERT(half == Half::FromBits(0x3400U));
+	}
+
+	/* Bulk conversion matches the scalar conversion (odd count covers the remainder loops) */
+	{
+		constexpr std::size_t count{ 1'003U };
+		std::vector<float> source(count);
+		for (std::size_t i{ 0U }; i < count; ++i)
+			source[i] = static_cast<float>(static_cast<ValueType>(i) * static_cast<ValueType>(0.37) - static_cast<ValueType>(100));
+
+		std::vector<Half> halves(count);
+		std::vector<float> converted(count);
+		CinMath::ConvertArray(source.data(), halves.data(), count);
+		CinMath::ConvertArray(halves.data(), converted.data(), count);
+
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < count; ++i)
+		{
+			success &= halves[i].Bits == Half{ source[i] }.Bits;
+			success &= std::abs(converted[i] - source[i]) <= std::abs(source[i]) * 0x1p-11f;
+		}
+		TEST_ASSERT(success);
+	}
+
+	/* Vectors and matrices */
+	{
+		const std::array<CinMath::Vector<3, float>, 3> vectors
+		{
+			CinMath::Vector<3, float>{ 1.0f, 2.0f, 3.0f },
+			CinMath::Vector<3, float>{ -0.5f, 0.25f, 1024.0f },
+			CinMath::Vector<3, float>{ 0.0f, -1.0f, 7.0f }
+		};
+		std::array<CinMath::Vector<3, Half>, 3> halfVectors;
+		std::array<CinMath::Vector<3, float>, 3> convertedVectors;
+		CinMath::ConvertArray(vectors.data(), halfVectors.data(), vectors.size());
+		CinMath::ConvertArray(halfVectors.data(), convertedVectors.data(), vectors.size());
+		TEST_ASSERT(convertedVectors == vectors);
+		TEST_ASSERT(halfVectors[1].z == Half{ 1024.0f });
+
+		const std::array<CinMath::Matrix<4, 4, float>, 2> matrices{ CinMath::Matrix<4, 4, float>::Identity(), CinMath::Matrix<4, 4, float>::Identity() * 0.5f };
+		std::array<CinMath::Matrix4h, 2> halfMatrices;
+		std::array<CinMath::Matrix<4, 4, float>, 2> convertedMatrices;
+		CinMath::ConvertArray(matrices.data(), halfMatrices.data(), matrices.size());
+		CinMath::ConvertArray(halfMatrices.data(), convertedMatrices.data(), matrices.size());
+		TEST_ASSERT(convertedMatrices == matrices);
+		TEST_ASSERT(sizeof(CinMath::Matrix4h) == 32U && sizeof(CinMath::Vector<4, Half>) == 8U);
+	}
+}
+
+template<typename ValueType>
+static void TestQuantization() noexcept
+{
+	using QuaternionType = CinMath::TQuaternion<ValueType>;
+	using Vector3Type = CinMath::Vector<3, ValueType>;
+
+	/* Distance between rotations, q and -q are the same rotation */
+	const auto quaternionError
+	{
+		[](const QuaternionType& lhs, const QuaternionType& rhs) noexcept -> ValueType
+		{
+			ValueType same{ 0 };
+			ValueType opposite{ 0 };
+			for (std::size_t i{ 0U }; i < 4U; ++i)
+			{
+				same = std::max(same, std::abs(lhs.raw[i] - rhs.raw[i]));
+				opposite = std::max(opposite, std::abs(lhs.raw[i] + rhs.raw[i]));
+			}
+			return std::min(same, opposite);
+		}
+	};
+
+	constexpr std::size_t count{ 1'003U };
+	std::vector<QuaternionType> quaternions;
+	std::vector<Vector3Type> normals;
+	for (std::size_t i{ 0U }; i < count; ++i)
+	{
+		const ValueType t{ static_cast<ValueType>(i) };
+		const QuaternionType quaternion{ std::sin(t * static_cast<ValueType>(0.7)), std::cos(t * static_cast<ValueType>(1.3)), std::sin(t * static_cast<ValueType>(2.9) + static_cast<ValueType>(1)), std::cos(t * static_cast<ValueType>(0.3)) - static_cast<ValueType>(0.5) };
+		quaternions.push_back(CinMath::Normalize(quaternion));
+		normals.push_back(CinMath::Normalize(Vector3Type{ quaternion.b, quaternion.c, quaternion.d }));
+	}
+
+	/* Edge cases: identity, negative largest component, axes */
+	quaternions[0] = QuaternionType{ 1, 0, 0, 0 };
+	quaternions[1] = QuaternionType{ 0, 0, 0, -1 };
+	quaternions[2] = QuaternionType{ static_cast<ValueType>(0.5), static_cast<ValueType>(-0.5), static_cast<ValueType>(0.5), static_cast<ValueType>(-0.5) };
+	normals[0] = Vector3Type{ 0, 0, 1 };
+	normals[1] = Vector3Type{ 0, 0, -1 };
+	normals[2] = Vector3Type{ -1, 0, 0 };
+
+	/* Smallest-three, 32 and 48 bits */
+	{
+		std::vector<CinMath::PackedQuaternion32> packed32(count);
+		std::vector<CinMath::PackedQuaternion48> packed48(count);
+		std::vector<QuaternionType> unpacked32(count);
+		std::vector<QuaternionType> unpacked48(count);
+		CinMath::PackArray(quaternions.data(), packed32.data(), count);
+		CinMath::PackArray(quaternions.data(), packed48.data(), count);
+		CinMath::UnpackArray(packed32.data(), unpacked32.data(), count);
+		CinMath::UnpackArray(packed48.data(), unpacked48.data(), count);
+
+		bool matchesScalar{ true };
+		bool withinBounds{ true };
+		for (std::size_t i{ 0U }; i < count; ++i)
+		{
+			matchesScalar &= packed32[i].Bits == CinMath::PackQuaternion32(quaternions[i]).Bits;
+			matchesScalar &= unpacked32[i] == CinMath::Unpack(packed32[i]);
+			withinBounds &= quaternionError(unpacked32[i], quaternions[i]) <= static_cast<ValueType>(3e-3);
+			withinBounds &= quaternionError(unpacked48[i], quaternions[i]) <= static_cast<ValueType>(1e-4);
+		}
+		TEST_ASSERT(matchesScalar);
+		TEST_ASSERT(withinBounds);
+		TEST_ASSERT(unpacked32[0] == QuaternionType(1, 0, 0, 0) && unpacked48[1] == QuaternionType(0, 0, 0, 1));
+	}
+
+	/* Octahedral unit vectors */
+	{
+		std::vector<CinMath::PackedNormal32> packed(count);
+		std::vector<Vector3Type> unpacked(count);
+		CinMath::PackArray(normals.data(), packed.data(), count);
+		CinMath::UnpackArray(packed.data(), unpacked.data(), count);
+
+		bool matchesScalar{ true };
+		bool withinBounds{ true };
+		for (std::size_t i{ 0U }; i < count; ++i)
+		{
+			const Vector3Type scalar{ CinMath::Unpack(packed[i]) };
+			const CinMath::PackedNormal32 scalarPacked{ CinMath::PackNormal32(normals[i]) };
+			matchesScalar &= packed[i].X == scalarPacked.X && packed[i].Y == scalarPacked.Y;
+			matchesScalar &= unpacked[i].x == scalar.x && unpacked[i].y == scalar.y && unpacked[i].z == scalar.z;
+			withinBounds &= std::abs(unpacked[i].x - normals[i].x) <= static_cast<ValueType>(1e-4) && std::abs(unpacked[i].y - normals[i].y) <= static_cast<ValueType>(1e-4) && std::abs(unpacked[i].z - normals[i].z) <= static_cast<ValueType>(1e-4);
+		}
+		TEST_ASSERT(matchesScalar);
+		TEST_ASSERT(withinBounds);
+		TEST_ASSERT(unpacked[1] == Vector3Type(0, 0, -1) && unpacked[2].x == static_cast<ValueType>(-1));
+	}
+}
+
+template<typename ValueType>
+static void TestArchive() noexcept
+{
+	using MatrixType = CinMath::Matrix<4, 4, ValueType>;
+	using Vector3Type = CinMath::Vector<3, ValueType>;
+	using Vector4Type = CinMath::Vector<4, ValueType>;
+
+	/* The tier test suites run in parallel under ctest, every process gets its own files */
+#ifdef _WIN32
+	const std::string process{ std::to_string(GetCurrentProcessId()) };
+#else
+	const std::string process{ std::to_string(getpid()) };
+#endif
+	const std::filesystem::path directory{ std::filesystem::temp_directory_path() };
+	const std::string matricesPath{ (directory / ("CinMathArchiveMatrices" + process + (std::is_same_v<ValueType, float> ? "_32.bin" : "_64.bin"))).string() };
+	const std::string planesPath{ (directory / ("CinMathArchivePlanes" + process + (std::is_same_v<ValueType, float> ? "_32.bin" : "_64.bin"))).string() };
+
+	/* Removes the files however the test leaves */
+	struct RemoveFiles final
+	{
+		~RemoveFiles()
+		{
+			std::error_code error;
+			for (const std::string& path : Paths)
+				std::filesystem::remove(path, error);
+		}
+
+		std::array<std::string, 2> Paths;
+	} const removeFiles{ { matricesPath, planesPath } };
+
+	constexpr std::size_t count{ 37U };
+	std::vector<MatrixType> matrices;
+	std::vector<ValueType> x(count), y(count), z(count);
+	for (std::size_t i{ 0U }; i < count; ++i)
+	{
+		const ValueType t{ static_cast<ValueType>(i) };
+		matrices.push_back(CinMath::Translate(MatrixType::Identity(), Vector3Type{ t, -t, t * static_cast<ValueType>(0.5) }) * static_cast<ValueType>(0.25));
+		x[i] = t + static_cast<ValueType>(1);
+		y[i] = -t;
+		z[i] = t * t;
+	}
+
+	/* Array of structures */
+	{
+		const CinMath::ArchiveStatus written{ CinMath::WriteArchive(matricesPath.c_str(), matrices.data(), count) };
+		TEST_ASSERT(written == CinMath::ArchiveStatus::Success);
+
+		CinMath::MappedArchive archive;
+		const CinMath::ArchiveStatus opened{ written == CinMath::ArchiveStatus::Success ? archive.Open(matricesPath.c_str()) : written };
+		TEST_ASSERT(opened == CinMath::ArchiveStatus::Success);
+		if (opened != CinMath::ArchiveStatus::Success)
+			return;
+
+		TEST_ASSERT(archive.GetHeader().Count == count && archive.GetHeader().Layout == CinMath::ArchiveLayout::ArrayOfStructures);
+
+		const std::span<const MatrixType> mapped{ archive.GetElements<MatrixType>() };
+		bool success{ mapped.size() == count && CinMath::IsAligned<CinMath::ArchiveAlignment>(mapped.data()) };
+		for (std::size_t i{ 0U }; success && i < count; ++i)
+			success &= mapped[i] == matrices[i];
+
+		TEST_ASSERT(success);
+		if (mapped.size() != count)
+			return;
+
+		/* Spans of another type or layout are empty, read-only archives hand out no mutable spans */
+		TEST_ASSERT(archive.GetElements<Vector4Type>().empty() && archive.GetPlane<MatrixType>(0U).empty());
+		TEST_ASSERT(archive.GetMutableElements<MatrixType>().empty());
+
+		/* Mapped spans feed the batch kernels directly */
+		std::vector<MatrixType> products(count);
+		CinMath::MultiplyArray(matrices[3], mapped.data(), products.data(), count);
+		TEST_ASSERT(ApproximateMatrix(products[count - 1U], matrices[3] * matrices[count - 1U]));
+
+		CinMath::MappedArchive moved{ std::move(archive) };
+		TEST_ASSERT(!archive.IsOpen() && moved.IsOpen() && moved.GetElements<MatrixType>().data() == mapped.data());
+	}
+
+	/* Structure of arrays, written copy-on-write in place */
+	{
+		const ValueType* const planes[3]{ x.data(), y.data(), z.data() };
+		const CinMath::ArchiveStatus written{ CinMath::WriteArchivePlanes<Vector3Type>(planesPath.c_str(), planes, count) };
+		TEST_ASSERT(written == CinMath::ArchiveStatus::Success);
+
+		CinMath::MappedArchive archive;
+		const CinMath::ArchiveStatus opened{ written == CinMath::ArchiveStatus::Success ? archive.Open(planesPath.c_str(), CinMath::ArchiveAccess::CopyOnWrite) : written };
+		TEST_ASSERT(opened == CinMath::ArchiveStatus::Success);
+		if (opened != CinMath::ArchiveStatus::Success)
+			return;
+
+		const std::span<ValueType> mappedX{ archive.GetMutablePlane<Vector3Type>(0U) };
+		const std::span<ValueType> mappedY{ archive.GetMutablePlane<Vector3Type>(1U) };
+		const std::span<ValueType> mappedZ{ archive.GetMutablePlane<Vector3Type>(2U) };
+		const bool mappedAll{ mappedX.size() == count && mappedY.size() == count && mappedZ.size() == count };
+		TEST_ASSERT(mappedAll && CinMath::IsAligned<CinMath::ArchiveAlignment>(mappedY.data()) && CinMath::IsAligned<CinMath::ArchiveAlignment>(mappedZ.data()));
+		if (!mappedAll)
+			return;
+		TEST_ASSERT(archive.GetPlane<Vector3Type>(3U).empty() && archive.GetElements<Vector3Type>().empty());
+
+		bool success{ true };
+		for (std::size_t i{ 0U }; i < count; ++i)
+			success &= mappedX[i] == x[i] && mappedY[i] == y[i] && mappedZ[i] == z[i];
+
+		TEST_ASSERT(success);
+
+		CinMath::NormalizeArray(mappedX.data(), mappedY.data(), mappedZ.data(), count);
+		TEST_ASSERT(Approximate(CinMath::Length(Vector3Type{ mappedX[5], mappedY[5], mappedZ[5] }), static_cast<ValueType>(1)));
+
+		/* The file itself is untouched */
+		CinMath::MappedArchive original;
+		TEST_ASSERT(original.Open(planesPath.c_str()) == CinMath::ArchiveStatus::Success && original.GetPlane<Vector3Type>(2U).size() == count && original.GetPlane<Vector3Type>(2U)[5] == z[5]);
+	}
+
+	/* Damaged files are rejected */
+	{
+		CinMath::MappedArchive archive;
+		TEST_ASSERT(archive.Open((directory / "CinMathArchiveMissing.bin").string().c_str()) == CinMath::ArchiveStatus::CannotOpen);
+
+		std::vector<char> bytes;
+		{
+			std::FILE* const file{ std::fopen(matricesPath.c_str(), "rb") };
+			std::error_code error;
+			const std::uintmax_t size{ std::filesystem::file_size(matricesPath, error) };
+			bytes.resize(error ? 0U : static_cast<std::size_t>(size));
+			const bool read{ file && !error && std::fread(bytes.data(), 1U, bytes.size(), file) == bytes.size() };
+			TEST_ASSERT(read);
+			if (file)
+				std::fclose(file);
+			/* The corruptions below index into the header and the first element */
+			if (!read || bytes.size() <= CinMath::ArchiveAlignment + 7U)
+				return;
+		}
+
+		const auto rewrite = [&matricesPath](const std::vector<char>& content) noexcept
+		{
+			std::FILE* const file{ std::fopen(matricesPath.c_str(), "wb") };
+			if (file)
+			{
+				std::fwrite(content.data(), 1U, content.size(), file);
+				std::fclose(file);
+			}
+		};
+
+		std::vector<char> corrupted{ bytes };
+		corrupted[CinMath::ArchiveAlignment + 7U] ^= 1;
+		rewrite(corrupted);
+		TEST_ASSERT(archive.Open(matricesPath.c_str()) == CinMath::ArchiveStatus::ChecksumMismatch && !archive.IsOpen());
+		TEST_ASSERT(archive.Open(matricesPath.c_str(), CinMath::ArchiveAccess::ReadOnly, false) == CinMath::ArchiveStatus::Success);
+
+		rewrite(std::vector<char>(bytes.begin(), bytes.end() - 1));
+		TEST_ASSERT(archive.Open(matricesPath.c_str()) == CinMath::ArchiveStatus::Truncated);
+
+		std::vector<char> newer{ bytes };
+		newer[8U] = 2;
+		rewrite(newer);
+		TEST_ASSERT(archive.Open(matricesPath.c_str()) == CinMath::ArchiveStatus::UnsupportedVersion);
+
+		rewrite(std::vector<char>(bytes.begin(), bytes.begin() + 16U));
+		TEST_ASSERT(archive.Open(matricesPath.c_str()) == CinMath::ArchiveStatus::InvalidHeader);
+	}
+}
+
+template<typename ValueType>
+static void TestFormat() noexcept
+{
+	using MatrixType = CinMath::Matrix<4, 4, ValueType>;
+	using Vector3Type = CinMath::Vector<3, ValueType>;
+	using QuaternionType = CinMath::TQuaternion<ValueType>;
+
+	char buffer[1024];
+	const auto text = [&buffer](const std::to_chars_result result) noexcept
+	{
+		return result.ec == std::errc{} ? std::string_view{ buffer, static_cast<std::size_t>(result.ptr - buffer) } : std::string_view{};
+	};
+
+	/* Shortest form */
+	TEST_ASSERT(text(CinMath::Format(buffer, std::end(buffer), Vector3Type{ 1, static_cast<ValueType>(-0.5), static_cast<ValueType>(1e10) })) == "[1, -0.5, 1e+10]");
+	TEST_ASSERT(text(CinMath::Format(buffer, std::end(buffer), QuaternionType{ 1, 0, 0, static_cast<ValueType>(0.25) })) == "[1, 0, 0, 0.25]");
+	TEST_ASSERT(text(CinMath::Format(buffer, std::end(buffer), CinMath::Matrix<2, 2, ValueType>{ 1, 2, 3, 4 })) == "[[1, 2], [3, 4]]");
+
+	/* Round trip keeps every bit */
+	{
+		const ValueType third{ static_cast<ValueType>(1) / static_cast<ValueType>(3) };
+		MatrixType matrix;
+		for (std::size_t i{ 0U }; i < 16U; ++i)
+			matrix[i] = third * static_cast<ValueType>(i) - std::numeric_limits<ValueType>::min() * static_cast<ValueType>(i & 1U);
+
+		const std::to_chars_result formatted{ CinMath::Format(buffer, std::end(buffer), matrix) };
+		MatrixType parsed{ static_cast<ValueType>(7) };
+		const std::from_chars_result result{ CinMath::Parse(buffer, formatted.ptr, parsed) };
+		TEST_ASSERT(formatted.ec == std::errc{} && result.ec == std::errc{} && result.ptr == formatted.ptr && parsed == matrix);
+
+		const QuaternionType quaternion{ third, -third, std::numeric_limits<ValueType>::max(), std::numeric_limits<ValueType>::denorm_min() };
+		QuaternionType parsedQuaternion;
+		const std::to_chars_result formattedQuaternion{ CinMath::Format(buffer, std::end(buffer), quaternion) };
+		TEST_ASSERT(CinMath::Parse(buffer, formattedQuaternion.ptr, parsedQuaternion).ec == std::errc{} && parsedQuaternion == quaternion);
+	}
+
+	/* Parsing skips whitespace and reports the position of errors */
+	{
+		const std::string_view spaced{ " [ 1 ,\n2,3 ] tail" };
+		Vector3Type vector;
+		const std::from_chars_result result{ CinMath::Parse(spaced.data(), spaced.data() + spaced.size(), vector) };
+		TEST_ASSERT(result.ec == std::errc{} && vector == Vector3Type(1, 2, 3) && std::string_view{ result.ptr } == " tail");
+
+		const std::string_view missing{ "[1, 2]" };
+		const std::from_chars_result failure{ CinMath::Parse(missing.data(), missing.data() + missing.size(), vector) };
+		TEST_ASSERT(failure.ec == std::errc::invalid_argument && failure.ptr == missing.data() + 5);
+
+		const std::string_view garbage{ "[1, x, 3]" };
+		TEST_ASSERT(CinMath::Parse(garbage.data(), garbage.data() + garbage.size(), vector).ec == std::errc::invalid_argument);
+	}
+
+	/* Buffers that are too small are reported, not overrun */
+	{
+		char small[8];
+		const std::to_chars_result result{ CinMath::Format(small, std::end(small), Vector3Type{ 100, 200, 300 }) };
+		TEST_ASSERT(result.ec == std::errc::value_too_large && result.ptr == std::end(small));
+	}
+
+	/* Bulk CSV and JSON */
+	{
+		const Vector3Type vectors[3]{ Vector3Type{ 1, 2, 3 }, Vector3Type{ static_cast<ValueType>(-1.5), 0, 4 }, Vector3Type{ 0, 0, 1 } };
+		TEST_ASSERT(text(CinMath::FormatArray(buffer, std::end(buffer), vectors, 3U, CinMath::TextFormat::Csv)) == "1,2,3\n-1.5,0,4\n0,0,1\n");
+		TEST_ASSERT(text(CinMath::FormatArray(buffer, std::end(buffer), vectors, 2U, CinMath::TextFormat::Json)) == "[\n[1, 2, 3],\n[-1.5, 0, 4]\n]\n");
+		TEST_ASSERT(text(CinMath::FormatArray(buffer, std::end(buffer), vectors, 0U, CinMath::TextFormat::Json)) == "[\n]\n");
+
+		/* JSON has no inf or nan, CSV and Format keep them so they read back */
+		const ValueType infinity{ std::numeric_limits<ValueType>::infinity() };
+		const Vector3Type nonFinite{ infinity, -infinity, std::numeric_limits<ValueType>::quiet_NaN() };
+		TEST_ASSERT(text(CinMath::FormatArray(buffer, std::end(buffer), &nonFinite, 1U, CinMath::TextFormat::Json)) == "[\n[null, null, null]\n]\n");
+		TEST_ASSERT(text(CinMath::FormatArray(buffer, std::end(buffer), &nonFinite, 1U, CinMath::TextFormat::Csv)) == "inf,-inf,nan\n");
+		TEST_ASSERT(text(CinMath::Format(buffer, std::end(buffer), nonFinite)) == "[inf, -inf, nan]");
+
+		MatrixType nonFiniteMatrix{ MatrixType::Identity() };
+		nonFiniteMatrix[5] = infinity;
+		TEST_ASSERT(text(CinMath::FormatArray(buffer, std::end(buffer), &nonFiniteMatrix, 1U, CinMath::TextFormat::Json)) == "[\n[[1, 0, 0, 0], [0, null, 0, 0], [0, 0, 1, 0], [0, 0, 0, 1]]\n]\n");
+
+		const MatrixType identity{ MatrixType::Identity() };
+		TEST_ASSERT(text(CinMath::FormatArray(buffer, std::end(buffer), &identity, 1U, CinMath::TextFormat::Csv)) == "1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1\n");
+
+		/* The bound holds for the longest values */
+		MatrixType worst;
+		for (std::size_t i{ 0U }; i < 16U; ++i)
+			worst[i] = -std::numeric_limits<ValueType>::min() * static_cast<ValueType>(1.2345678901234567);
+
+		const std::size_t bound{ CinMath::MaxFormattedArrayLength<ValueType>(16U, 2U, CinMath::TextFormat::Json) };
+		const MatrixType worstPair[2]{ worst, worst };
+		TEST_ASSERT(bound <= sizeof(buffer) && CinMath::FormatArray(buffer, buffer + bound, worstPair, 2U, CinMath::TextFormat::Json).ec == std::errc{});
+	}
+}
+
+template<typename ValueType>
+static void TestMatrixPrinting() noexcept
+{
+	using namespace CinMath::Printing;
+
+	/* Columns are as wide as the widest value, the last one included */
+	{
+		std::ostringstream stream;
+		stream << MatrixPrinter(CinMath::Matrix<2, 2, ValueType>{ 1, 2, 3, 100 }, NakedMatrixPrintSpecificer());
+		TEST_ASSERT(stream.str() == "\n           \n    1   2  \n    3 100  \n           \n");
+	}
+
+	/* Fractions are padded to the longest one, the stream formatting is left alone */
+	{
+		std::ostringstream stream;
+		stream << std::setprecision(2);
+		stream << MatrixPrinter(CinMath::Matrix<2, 2, ValueType>{ static_cast<ValueType>(-2.5), 0, static_cast<ValueType>(0.125), 10 }, NakedMatrixPrintSpecificer());
+		TEST_ASSERT(stream.str() == "\n                   \n  -2.5000  0.0000  \n   0.1250 10.0000  \n                   \n");
+		TEST_ASSERT(stream.precision() == 2 && !(stream.flags() & std::ios_base::fixed));
+	}
+}
+
+template<typename ValueType>
+static void TestPipeline() noexcept
+{
+	using namespace CinMath::Pipeline;
+	using MatrixType = CinMath::Matrix<4, 4, ValueType>;
+	using Vector4Type = CinMath::Vector<4, ValueType>;
+
+	constexpr std::size_t count{ 100'003U };
+	std::vector<Vector4Type> directions(count);
+	for (std::size_t i{ 0U }; i < count; ++i)
+	{
+		const ValueType t{ static_cast<ValueType>(i) };
+		directions[i] = Vector4Type{ std::sin(t * static_cast<ValueType>(0.37)), std::cos(t * static_cast<ValueType>(0.11)) + static_cast<ValueType>(1.5), t * static_cast<ValueType>(1e-4), 0 };
+	}
+
+	const MatrixType rotation{ CinMath::RotateZIdentity<4, 4, ValueType>(CinMath::TAngle<ValueType>{ CinMath::TRadians<ValueType>{ static_cast<ValueType>(0.6) } }) };
+
+	/* Same result as separate passes */
+	std::vector<Vector4Type> expected(count);
+	CinMath::TransformPoints(rotation, directions.data(), expected.data(), count);
+	CinMath::NormalizeArray(expected.data(), expected.data(), count);
+
+	Vector4Type minimum{ std::numeric_limits<ValueType>::max() };
+	Vector4Type maximum{ -std::numeric_limits<ValueType>::max() };
+	for (const Vector4Type& vector : expected)
+	{
+		minimum = CinMath::Min(minimum, vector);
+		maximum = CinMath::Max(maximum, vector);
+	}
+
+	std::vector<Vector4Type> stored(count);
+	const auto pipeline{ Transform(rotation) | Normalize() | Store(stored.data()) | BoundsReduce() };
+	const Bounds<Vector4Type> bounds{ Run(pipeline, directions.data(), count) };
+	TEST_ASSERT(bounds.Minimum == minimum && bounds.Maximum == maximum);
+
+	bool success{ true };
+	for (std::size_t i{ 0U }; i < count; ++i)
+		success &= stored[i] == expected[i];
+
+	TEST_ASSERT(success);
+
+	/* Chunked on a pool, the partials are merged in order */
+	CinMath::ThreadPool pool{ 3U };
+	const Bounds<Vector4Type> parallelBounds{ Run(pool, pipeline, directions.data(), count) };
+	TEST_ASSERT(parallelBounds.Minimum == minimum && parallelBounds.Maximum == maximum);
+
+	const auto sum{ Map([](const Vector4Type& vector) noexcept { return vector * static_cast<ValueType>(2); }) | SumReduce() };
+	const Vector4Type serialSum{ Run(sum, directions.data(), count) };
+	const Vector4Type parallelSum{ Run(pool, sum, directions.data(), count) };
+	const auto close{ [](const ValueType lhs, const ValueType rhs) noexcept { return std::abs(lhs - rhs) <= static_cast<ValueType>(1e-3) * std::max(std::abs(rhs), static_cast<ValueType>(1)); } };
+	TEST_ASSERT(close(serialSum.x, parallelSum.x) && close(serialSum.y, parallelSum.y) && close(serialSum.z, parallelSum.z));
+	TEST_ASSERT(Run(pool, sum, directions.data(), count) == parallelSum);
+
+	/* Pipelines without a reduction, the index is passed to the stages */
+	std::vector<Vector4Type> indexed(count);
+	Run(pool, Map([](const Vector4Type& vector, const std::size_t index) noexcept { return vector + Vector4Type{ static_cast<ValueType>(index) }; }) | Store(indexed.data()), directions.data(), count);
+	TEST_ASSERT(indexed[count - 1U] == directions[count - 1U] + Vector4Type{ static_cast<ValueType>(count - 1U) });
+
+	/* Empty input gives the identity */
+	const Bounds<Vector4Type> empty{ Run(BoundsReduce(), directions.data(), 0U) };
+	TEST_ASSERT(empty.Minimum.x == std::numeric_limits<ValueType>::max() && empty.Maximum.w == -std::numeric_limits<ValueType>::max());
+
+	/* Bounds of other vector lengths are reduced component by component */
+	{
+		using Vector3Type = CinMath::Vector<3, ValueType>;
+		std::vector<Vector3Type> points(count);
+		for (std::size_t i{ 0U }; i < count; ++i)
+			points[i] = Vector3Type{ directions[i].x, directions[i].y, directions[i].z };
+
+		const auto scaled{ Map([](const Vector3Type& point) noexcept { return point * static_cast<ValueType>(2); }) | BoundsReduce() };
+		const Bounds<Vector3Type> pointBounds{ Run(pool, scaled, points.data(), count) };
+		const auto bounded{ [&pointBounds](const ValueType component, const std::size_t axis) noexcept { return component * 2 >= pointBounds.Minimum[axis] && component * 2 <= pointBounds.Maximum[axis]; } };
+
+		bool inside{ true };
+		for (const Vector3Type& point : points)
+			inside &= bounded(point.x, 0U) && bounded(point.y, 1U) && bounded(point.z, 2U);
+
+		TEST_ASSERT(inside && pointBounds.Minimum.z == static_cast<ValueType>(0) && pointBounds.Maximum.z == points[count - 1U].z * 2);
+		TEST_ASSERT(pointBounds.Minimum == Run(scaled, points.data(), count).Minimum);
+	}
+}
+
+template<typename ValueType>
+static void TestProfile() noexcept
+{
+	using MatrixType = CinMath::Matrix<4, 4, ValueType>;
+	using Vector4Type = CinMath::Vector<4, ValueType>;
+
+	constexpr std::size_t count{ 100U };
+	const std::vector<Vector4Type> points(count, Vector4Type{ 1, 2, 3, 1 });
+	std::vector<Vector4Type> transformed(count);
+	const MatrixType translation{ CinMath::Translate(MatrixType::Identity(), CinMath::Vector<3, ValueType>{ 1, 2, 3 }) };
+
+	CinMath::ProfileReset();
+	CinMath::TransformPoints(translation, points.data(), transformed.data(), count);
+	CinMath::TransformPoints(translation, points.data(), transformed.data(), count);
+
+	/* Counted per call, not per element */
+	CinMath::ProfileSnapshot snapshot{ CinMath::ProfileCapture() };
+	TEST_ASSERT(snapshot[CinMath::ProfileKernel::TransformPoints].Calls == 2U);
+	TEST_ASSERT(snapshot[CinMath::ProfileKernel::TransformPoints].Elements == 2U * count);
+	TEST_ASSERT(snapshot[CinMath::ProfileKernel::TransformPoints].Cycles > 0U);
+	TEST_ASSERT(snapshot[CinMath::ProfileKernel::CullSpheres].Calls == 0U);
+
+	/* Counters of exited threads are kept */
+	std::thread worker{ [&]()
+	{
+		const std::array<Vector4Type, 6> planes{ Vector4Type{ 1, 0, 0, 10 }, Vector4Type{ -1, 0, 0, 10 }, Vector4Type{ 0, 1, 0, 10 }, Vector4Type{ 0, -1, 0, 10 }, Vector4Type{ 0, 0, 1, 10 }, Vector4Type{ 0, 0, -1, 10 } };
+		std::vector<std::uint8_t> visibility(count);
+		CinMath::CullSpheres(planes, transformed.data(), visibility.data(), count);
+	} };
+	worker.join();
+
+	snapshot = CinMath::ProfileCapture();
+	TEST_ASSERT(snapshot[CinMath::ProfileKernel::CullSpheres].Calls == 1U && snapshot[CinMath::ProfileKernel::CullSpheres].Elements == count);
+	TEST_ASSERT(snapshot[CinMath::ProfileKernel::TransformPoints].Calls == 2U);
+
+	std::ostringstream dump;
+	CinMath::ProfileDump(dump, snapshot);
+	TEST_ASSERT(dump.str().find("TransformPoints,2,200,") != std::string::npos);
+	TEST_ASSERT(dump.str().find("MultiplyChain") == std::string::npos);
+
+	/* Only calls made while tracing are exported */
+	CinMath::ProfileSetTracing(true);
+	CinMath::NormalizeArray(transformed.data(), transformed.data(), count);
+	CinMath::ProfileSetTracing(false);
+	CinMath::NormalizeArray(transformed.data(), transformed.data(), count);
+
+	std::ostringstream trace;
+	CinMath::ProfileWriteChromeTrace(trace);
+	const std::string json{ trace.str() };
+	TEST_ASSERT(json.starts_with("{\"traceEvents\":["));
+	TEST_ASSERT(json.find("\"name\":\"NormalizeArray\"") != std::string::npos);
+	TEST_ASSERT(json.find("\"name\":\"NormalizeArray\"", json.find("\"name\":\"NormalizeArray\"") + 1U) == std::string::npos);
+	TEST_ASSERT(json.find("\"elements\":100") != std::string::npos);
+	TEST_ASSERT(json.find("TransformPoints") == std::string::npos);
+
+	CinMath::ProfileReset();
+	TEST_ASSERT(CinMath::ProfileCapture()[CinMath::ProfileKernel::NormalizeArray].Calls == 0U);
+}
+
+/*
+ * Cross tier equivalence. Every operator and Transform.inl function runs on the same pseudo random inputs in every
+ * instruction set build: the default (scalar) build writes its results with --equivalence-write <file>, the SIMD
+ * builds recompute them and compare with --equivalence-check <file>, printing the largest difference per kernel.
+ * Differences are counted in ULPs of max(|reference|, 1): the inputs lie in [-1, 1], so a result that cancels to
+ * almost zero is held to the precision of its operands rather than to a relative bound no summation order meets
+ */
+static constexpr std::size_t s_EquivalenceCases{ 1024U };
+
+/* Same sequence in every build and with every standard library (PCG style LCG, no std distributions) */
+template<typename ValueType>
+class EquivalenceInputs final
+{
+public:
+	ValueType Scalar() noexcept
+	{
+		State = State * 6364136223846793005ULL + 1442695040888963407ULL;
+		/*
+		 * The volatile keeps the rounding to ValueType: GCC 12 at -O3 -mavx can vectorize the conversion of consecutive
+		 * inputs and drop it, handing the unrounded doubles straight to AppendEquivalence
+		 */
+		const volatile ValueType value{ static_cast<ValueType>(static_cast<double>(State >> 11U) * 0x1.0p-52 - 1.0) };
+		return value;
+	}
+
+	/* Magnitude in [0.5, 1.5], for divisors and vectors that get normalized */
+	ValueType NonZero() noexcept
+	{
+		const ValueType value{ Scalar() };
+		return value < static_cast<ValueType>(0) ? value - static_cast<ValueType>(0.5) : value + static_cast<ValueType>(0.5);
+	}
+
+	template<CinMath::Length_t length>
+	CinMath::Vector<length, ValueType> Vector() noexcept
+	{
+		CinMath::Vector<length, ValueType> vector{};
+		for (CinMath::Length_t i{ 0U }; i < length; ++i)
+			vector.raw[i] = Scalar();
+
+		return vector;
+	}
+
+	template<CinMath::Length_t length>
+	CinMath::Vector<length, ValueType> NonZeroVector() noexcept
+	{
+		CinMath::Vector<length, ValueType> vector{};
+		for (CinMath::Length_t i{ 0U }; i < length; ++i)
+			vector.raw[i] = NonZero();
+
+		return vector;
+	}
+
+	/* Diagonally dominant, so the inverse exists and is well conditioned */
+	template<CinMath::Length_t size>
+	CinMath::Matrix<size, size, ValueType> Matrix() noexcept
+	{
+		CinMath::Matrix<size, size, ValueType> matrix{};
+		for (std::size_t i{ 0U }; i < size * size; ++i)
+			matrix.raw[i] = Scalar();
+
+		for (std::size_t i{ 0U }; i < size; ++i)
+			matrix.raw[i * size + i] += static_cast<ValueType>(size);
+
+		return matrix;
+	}
+
+	CinMath::TQuaternion<ValueType> Quaternion() noexcept
+	{
+		/*
+		 * Normalized here rather than with the library, whose result depends on the tier under test. The volatile
+		 * square keeps the compiler from contracting the sum into FMAs, which the avx2 build would otherwise do
+		 */
+		CinMath::TQuaternion<ValueType> quaternion{};
+		ValueType normSquared{ 0 };
+		for (std::size_t i{ 0U }; i < 4U; ++i)
+		{
+			quaternion.raw[i] = NonZero();
+			const volatile ValueType square{ quaternion.raw[i] * quaternion.raw[i] };
+			normSquared += square;
+		}
+
+		const ValueType norm{ std::sqrt(normSquared) };
+		for (std::size_t i{ 0U }; i < 4U; ++i)
+			quaternion.raw[i] /= norm;
+
+		return quaternion;
+	}
+
+	CinMath::TAngle<ValueType> Angle() noexcept
+	{
+		return CinMath::TAngle<ValueType>{ CinMath::TRadians<ValueType>{ Scalar() * CinMath::Constants::PI<ValueType> } };
+	}
+private:
+	std::uint64_t State{ 0x853C49E6748FEA9BULL };
+};
+
+template<typename ValueType>
+static void AppendEquivalence(std::vector<double>& results, const ValueType value) noexcept
+{
+	results.push_back(static_cast<double>(value));
+}
+
+template<CinMath::Length_t length, typename ValueType>
+static void AppendEquivalence(std::vector<double>& results, const CinMath::Vector<length, ValueType>& vector) noexcept
+{
+	results.insert(results.end(), vector.raw, vector.raw + length);
+}
+
+template<CinMath::Length_t rows, CinMath::Length_t columns, typename ValueType>
+static void AppendEquivalence(std::vector<double>& results, const CinMath::Matrix<rows, columns, ValueType>& matrix) noexcept
+{
+	results.insert(results.end(), matrix.raw, matrix.raw + rows * columns);
+}
+
+template<typename ValueType>
+static void AppendEquivalence(std::vector<double>& results, const CinMath::TQuaternion<ValueType>& quaternion) noexcept
+{
+	results.insert(results.end(), quaternion.raw, quaternion.raw + 4U);
+}
+
+struct EquivalenceKernel final
+{
+	std::string Name;
+	/* Largest accepted difference of a SIMD tier, in ULPs of the value type */
+	double MaxUlps;
+	/* float results are stored exactly as doubles */
+	std::vector<double> Results;
+};
+
+template<typename ValueType>
+class EquivalenceRecorder final
+{
+public:
+	/* Every kernel starts from the same inputs, adding a kernel does not change the inputs of the others */
+	template<typename Function>
+	void Record(const std::string_view name, const double maxUlps, Function function)
+	{
+		EquivalenceInputs<ValueType> inputs{};
+		EquivalenceKernel kernel{ std::string{ name } + (std::is_same_v<ValueType, float> ? "<float>" : "<double>"), maxUlps, {} };
+		for (std::size_t i{ 0U }; i < s_EquivalenceCases; ++i)
+			AppendEquivalence(kernel.Results, function(inputs));
+
+		Kernels.push_back(std::move(kernel));
+	}
+
+	std::vector<EquivalenceKernel> Kernels;
+};
+
+template<CinMath::Length_t length, typename ValueType>
+static void RecordVectorEquivalence(EquivalenceRecorder<ValueType>& recorder, const std::string_view type)
+{
+	using Inputs = EquivalenceInputs<ValueType>;
+	const std::string prefix{ type };
+
+	recorder.Record(prefix + " + " + prefix, 0.0, [](Inputs& in) { const auto lhs{ in.template Vector<length>() }; const auto rhs{ in.template Vector<length>() }; return lhs + rhs; });
+	recorder.Record(prefix + " - " + prefix, 0.0, [](Inputs& in) { const auto lhs{ in.template Vector<length>() }; const auto rhs{ in.template Vector<length>() }; return lhs - rhs; });
+	recorder.Record(prefix + " * " + prefix, 0.0, [](Inputs& in) { const auto lhs{ in.template Vector<length>() }; const auto rhs{ in.template Vector<length>() }; return lhs * rhs; });
+	recorder.Record(prefix + " / " + prefix, 1.0, [](Inputs& in) { const auto lhs{ in.template Vector<length>() }; const auto rhs{ in.template NonZeroVector<length>() }; return lhs / rhs; });
+	recorder.Record(prefix + " + scalar", 0.0, [](Inputs& in) { const auto vector{ in.template Vector<length>() }; const auto scalar{ in.Scalar() }; return vector + scalar; });
+	recorder.Record(prefix + " - scalar", 0.0, [](Inputs& in) { const auto vector{ in.template Vector<length>() }; const auto scalar{ in.Scalar() }; return vector - scalar; });
+	recorder.Record(prefix + " * scalar", 0.0, [](Inputs& in) { const auto vector{ in.template Vector<length>() }; const auto scalar{ in.Scalar() }; return vector * scalar; });
+	recorder.Record(prefix + " / scalar", 1.0, [](Inputs& in) { const auto vector{ in.template Vector<length>() }; const auto divisor{ in.NonZero() }; return vector / divisor; });
+	recorder.Record("-" + prefix, 0.0, [](Inputs& in) { return -in.template Vector<length>(); });
+	recorder.Record("Length(" + prefix + ")", 4.0, [](Inputs& in) { return CinMath::Length(in.template NonZeroVector<length>()); });
+	recorder.Record("Normalize(" + prefix + ")", 4.0, [](Inputs& in) { return CinMath::Normalize(in.template NonZeroVector<length>()); });
+	/* Room for an rsqrt estimate refined by one Newton step */
+	recorder.Record("NormalizeFast(" + prefix + ")", 64.0, [](Inputs& in) { return CinMath::NormalizeFast(in.template NonZeroVector<length>()); });
+	recorder.Record("Dot(" + prefix + ")", 4.0, [](Inputs& in) { const auto lhs{ in.template Vector<length>() }; const auto rhs{ in.template Vector<length>() }; return CinMath::Dot(lhs, rhs); });
+	if constexpr (length >= 3U)
+		recorder.Record("Cross(" + prefix + ")", 4.0, [](Inputs& in) { const auto lhs{ in.template Vector<length>() }; const auto rhs{ in.template Vector<length>() }; return CinMath::Cross(lhs, rhs); });
+}
+
+template<CinMath::Length_t size, typename ValueType>
+static void RecordMatrixEquivalence(EquivalenceRecorder<ValueType>& recorder, const std::string_view type)
+{
+	using Inputs = EquivalenceInputs<ValueType>;
+	const std::string prefix{ type };
+
+	recorder.Record(prefix + " + " + prefix, 0.0, [](Inputs& in) { const auto lhs{ in.template Matrix<size>() }; const auto rhs{ in.template Matrix<size>() }; return lhs + rhs; });
+	recorder.Record(prefix + " - " + prefix, 0.0, [](Inputs& in) { const auto lhs{ in.template Matrix<size>() }; const auto rhs{ in.template Matrix<size>() }; return lhs - rhs; });
+	recorder.Record(prefix + " * " + prefix, 16.0, [](Inputs& in) { const auto lhs{ in.template Matrix<size>() }; const auto rhs{ in.template Matrix<size>() }; return lhs * rhs; });
+	recorder.Record(prefix + " + scalar", 0.0, [](Inputs& in) { const auto matrix{ in.template Matrix<size>() }; const auto scalar{ in.Scalar() }; return matrix + scalar; });
+	recorder.Record(prefix + " - scalar", 0.0, [](Inputs& in) { const auto matrix{ in.template Matrix<size>() }; const auto scalar{ in.Scalar() }; return matrix - scalar; });
+	recorder.Record(prefix + " * scalar", 0.0, [](Inputs& in) { const auto matrix{ in.template Matrix<size>() }; const auto scalar{ in.Scalar() }; return matrix * scalar; });
+	recorder.Record(prefix + " / scalar", 1.0, [](Inputs& in) { const auto matrix{ in.template Matrix<size>() }; const auto divisor{ in.NonZero() }; return matrix / divisor; });
+	recorder.Record("-" + prefix, 0.0, [](Inputs& in) { return -in.template Matrix<size>(); });
+	recorder.Record("Transpose(" + prefix + ")", 0.0, [](Inputs& in) { return CinMath::Transpose(in.template Matrix<size>()); });
+	recorder.Record("Determinant(" + prefix + ")", 64.0, [](Inputs& in) { return CinMath::Determinant(in.template Matrix<size>()); });
+	recorder.Record("Inverse(" + prefix + ")", 64.0, [](Inputs& in) { return CinMath::Inverse(in.template Matrix<size>()); });
+}
+
+template<typename ValueType>
+static void RecordEquivalence(EquivalenceRecorder<ValueType>& recorder)
+{
+	using Inputs = EquivalenceInputs<ValueType>;
+
+	RecordVectorEquivalence<2U>(recorder, "Vector2");
+	RecordVectorEquivalence<3U>(recorder, "Vector3");
+	RecordVectorEquivalence<4U>(recorder, "Vector4");
+
+	RecordMatrixEquivalence<2U>(recorder, "Matrix2");
+	RecordMatrixEquivalence<3U>(recorder, "Matrix3");
+	RecordMatrixEquivalence<4U>(recorder, "Matrix4");
+	recorder.Record("Matrix4 * Vector4", 16.0, [](Inputs& in) { const auto matrix{ in.template Matrix<4U>() }; const auto vector{ in.template Vector<4U>() }; return matrix * vector; });
+	recorder.Record("Vector4 * Matrix4", 16.0, [](Inputs& in) { const auto vector{ in.template Vector<4U>() }; const auto matrix{ in.template Matrix<4U>() }; return vector * matrix; });
+
+	recorder.Record("Quaternion + Quaternion", 0.0, [](Inputs& in) { const auto lhs{ in.Quaternion() }; const auto rhs{ in.Quaternion() }; return lhs + rhs; });
+	recorder.Record("Quaternion - Quaternion", 0.0, [](Inputs& in) { const auto lhs{ in.Quaternion() }; const auto rhs{ in.Quaternion() }; return lhs - rhs; });
+	recorder.Record("Quaternion * Quaternion", 4.0, [](Inputs& in) { const auto lhs{ in.Quaternion() }; const auto rhs{ in.Quaternion() }; return lhs * rhs; });
+	recorder.Record("Quaternion / Quaternion", 16.0, [](Inputs& in) { const auto lhs{ in.Quaternion() }; const auto rhs{ in.Quaternion() }; return lhs / rhs; });
+	recorder.Record("Quaternion * scalar", 0.0, [](Inputs& in) { const auto quaternion{ in.Quaternion() }; const auto scalar{ in.Scalar() }; return quaternion * scalar; });
+	recorder.Record("Quaternion / scalar", 1.0, [](Inputs& in) { const auto quaternion{ in.Quaternion() }; const auto divisor{ in.NonZero() }; return quaternion / divisor; });
+	recorder.Record("-Quaternion", 0.0, [](Inputs& in) { return -in.Quaternion(); });
+	recorder.Record("Conjugate(Quaternion)", 0.0, [](Inputs& in) { return CinMath::Conjugate(in.Quaternion()); });
+	recorder.Record("Norm(Quaternion)", 4.0, [](Inputs& in) { const auto quaternion{ in.Quaternion() }; const auto scale{ in.NonZero() }; return CinMath::Norm(quaternion * scale); });
+	recorder.Record("NormSquared(Quaternion)", 4.0, [](Inputs& in) { const auto quaternion{ in.Quaternion() }; const auto scale{ in.NonZero() }; return CinMath::NormSquared(quaternion * scale); });
+	recorder.Record("Normalize(Quaternion)", 4.0, [](Inputs& in) { const auto quaternion{ in.Quaternion() }; const auto scale{ in.NonZero() }; return CinMath::Normalize(quaternion * scale); });
+	recorder.Record("Inverse(Quaternion)", 16.0, [](Inputs& in) { const auto quaternion{ in.Quaternion() }; const auto scale{ in.NonZero() }; return CinMath::Inverse(quaternion * scale); });
+	recorder.Record("Rotate(Vector3, Quaternion)", 16.0, [](Inputs& in) { const auto vector{ in.template Vector<3U>() }; const auto quaternion{ in.Quaternion() }; return CinMath::Rotate(vector, quaternion); });
+	/* The axis angle conversions and RotateIdentity are implemented for float only */
+	if constexpr (std::is_same_v<ValueType, float>)
+	{
+		recorder.Record("AxisAngleToQuaternion(angle, axis)", 16.0, [](Inputs& in) { const auto angle{ in.Angle() }; const auto axis{ in.template NonZeroVector<3U>() }; return CinMath::AxisAngleToQuaternion(angle, CinMath::Normalize(axis)); });
+		recorder.Record("QuaternionToAxisAngle(Quaternion)", 16.0, [](Inputs& in) { return CinMath::QuaternionToAxisAngle(in.Quaternion()); });
+		recorder.Record("RotateIdentity(axis, angle)", 16.0, [](Inputs& in) { const auto axis{ in.template NonZeroVector<3U>() }; const auto angle{ in.Angle() }; return CinMath::RotateIdentity<4U, 4U, ValueType>(CinMath::Normalize(axis), angle); });
+	}
+
+	recorder.Record("Translate(Matrix4, Vector3)", 4.0, [](Inputs& in) { const auto matrix{ in.template Matrix<4U>() }; const auto vector{ in.template Vector<3U>() }; return CinMath::Translate(matrix, vector); });
+	recorder.Record("TranslateIdentity(Vector3)", 0.0, [](Inputs& in) { return CinMath::TranslateIdentity<4U, 4U, ValueType>(in.template Vector<3U>()); });
+	recorder.Record("RotateX(Matrix4, angle)", 16.0, [](Inputs& in) { const auto matrix{ in.template Matrix<4U>() }; const auto angle{ in.Angle() }; return CinMath::RotateX(matrix, angle); });
+	recorder.Record("RotateY(Matrix4, angle)", 16.0, [](Inputs& in) { const auto matrix{ in.template Matrix<4U>() }; const auto angle{ in.Angle() }; return CinMath::RotateY(matrix, angle); });
+	recorder.Record("RotateZ(Matrix4, angle)", 16.0, [](Inputs& in) { const auto matrix{ in.template Matrix<4U>() }; const auto angle{ in.Angle() }; return CinMath::RotateZ(matrix, angle); });
+	recorder.Record("RotateXIdentity(angle)", 0.0, [](Inputs& in) { return CinMath::RotateXIdentity<4U, 4U, ValueType>(in.Angle()); });
+	recorder.Record("RotateYIdentity(angle)", 0.0, [](Inputs& in) { return CinMath::RotateYIdentity<4U, 4U, ValueType>(in.Angle()); });
+	recorder.Record("RotateZIdentity(angle)", 0.0, [](Inputs& in) { return CinMath::RotateZIdentity<4U, 4U, ValueType>(in.Angle()); });
+	recorder.Record("Scale(Matrix4, Vector3)", 0.0, [](Inputs& in) { const auto matrix{ in.template Matrix<4U>() }; const auto vector{ in.template Vector<3U>() }; return CinMath::Scale(matrix, vector); });
+	recorder.Record("OrthographicProjection", 4.0, [](Inputs& in) { const auto left{ in.Scalar() - static_cast<ValueType>(2) }; const auto right{ in.Scalar() + static_cast<ValueType>(2) }; const auto bottom{ in.Scalar() - static_cast<ValueType>(2) }; const auto top{ in.Scalar() + static_cast<ValueType>(2) }; return CinMath::OrthographicProjection(left, right, bottom, top); });
+	recorder.Record("PerspectiveProjection", 4.0, [](Inputs& in) { const auto fieldOfView{ in.NonZero() }; const auto aspectRatio{ in.NonZero() }; return CinMath::PerspectiveProjection(fieldOfView, aspectRatio + static_cast<ValueType>(1.5), static_cast<ValueType>(0.1), static_cast<ValueType>(100)); });
+}
+
+static std::vector<EquivalenceKernel> RecordEquivalence()
+{
+	EquivalenceRecorder<float> floatRecorder;
+	RecordEquivalence(floatRecorder);
+
+	EquivalenceRecorder<double> doubleRecorder;
+	RecordEquivalence(doubleRecorder);
+
+	std::vector<EquivalenceKernel> kernels{ std::move(floatRecorder.Kernels) };
+	kernels.insert(kernels.end(), std::make_move_iterator(doubleRecorder.Kernels.begin()), std::make_move_iterator(doubleRecorder.Kernels.end()));
+	return kernels;
+}
+
+/* Text file, one line per kernel: name, result count and the results as hexadecimal floating point (exact) */
+static int WriteEquivalence(const char* path) noexcept
+{
+	std::ofstream file{ path };
+	if (!file)
+	{
+		std::cerr << "Cannot write " << path << '\n';
+		return 1;
+	}
+
+	file << std::hexfloat;
+	for (const EquivalenceKernel& kernel : RecordEquivalence())
+	{
+		file << kernel.Name << '\t' << kernel.Results.size();
+		for (const double result : kernel.Results)
+			file << ' ' << result;
+
+		file << '\n';
+	}
+
+	return file.good() ? 0 : 1;
+}
+
+static int CheckEquivalence(const char* path) noexcept
+{
+	std::ifstream file{ path };
+	if (!file)
+	{
+		std::cerr << "Cannot read " << path << ", run the default build with --equivalence-write first\n";
+		return 1;
+	}
+
+	std::vector<std::pair<std::string, std::vector<double>>> reference;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		const std::size_t tab{ line.find('\t') };
+		std::istringstream values{ line.substr(tab + 1U) };
+		std::size_t count{ 0U };
+		values >> count;
+
+		std::vector<double> results(count);
+		for (double& result : results)
+		{
+			/* operator>> does not read hexadecimal floating point in every standard library */
+			std::string token;
+			values >> token;
+			result = std::strtod(token.c_str(), nullptr);
+		}
+
+		reference.emplace_back(line.substr(0U, tab), std::move(results));
+	}
+
+	std::size_t failed{ 0U };
+	std::cout << std::left << std::setw(48) << "kernel" << std::right << std::setw(14) << "max ulps" << std::setw(12) << "bound" << std::setw(16) << "max abs error" << '\n';
+	for (const EquivalenceKernel& kernel : RecordEquivalence())
+	{
+		const auto match{ std::find_if(reference.begin(), reference.end(), [&kernel](const auto& entry) { return entry.first == kernel.Name; }) };
+		if (match == reference.end() || match->second.size() != kernel.Results.size())
+		{
+			std::cout << std::left << std::setw(48) << kernel.Name << " missing from the reference\n";
+			++failed;
+			continue;
+		}
+
+		const bool isFloat{ kernel.Name.ends_with("<float>") };
+		double maxUlps{ 0.0 };
+		double maxError{ 0.0 };
+		for (std::size_t i{ 0U }; i < kernel.Results.size(); ++i)
+		{
+			const double expected{ match->second[i] };
+			const double error{ std::abs(kernel.Results[i] - expected) };
+			const double scale{ std::max(std::abs(expected), 1.0) };
+			/* ULP of the value type at the scale of the result */
+			const double ulp{ isFloat ? static_cast<double>(std::nextafter(static_cast<float>(scale), std::numeric_limits<float>::infinity()) - static_cast<float>(scale)) : std::nextafter(scale, std::numeric_limits<double>::infinity()) - scale };
+			const double ulps{ std::isnan(error) ? (std::isnan(expected) && std::isnan(kernel.Results[i]) ? 0.0 : std::numeric_limits<double>::infinity()) : error / ulp };
+
+			maxUlps = std::max(maxUlps, ulps);
+			maxError = std::max(maxError, std::isnan(error) ? 0.0 : error);
+		}
+
+		const bool passed{ maxUlps <= kernel.MaxUlps };
+		failed += !passed;
+		std::cout << std::left << std::setw(48) << kernel.Name << std::right << std::setw(14) << maxUlps << std::setw(12) << kernel.MaxUlps << std::setw(16) << maxError << (passed ? "" : "  FAILED") << '\n';
+	}
+
+	std::cout << '\n' << failed << " kernel(s) beyond their bound\n";
+	return failed != 0U ? 1 : 0;
+}